@@ -0,0 +1,364 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d.hpp
+  * @author  Sensors Software Solution Team
+  * @brief   C++17 driver on the i3g4250d_reg.h register definitions,
+  *          bound at compile time to a bus policy (optional, header
+  *          only).
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_HPP
+#define I3G4250D_HPP
+
+/* Includes ------------------------------------------------------------------*/
+#include <cstring>
+#include "i3g4250d_reg.h"
+
+namespace i3g4250d
+{
+
+/**
+  * @brief  Position of the lowest bit of a field mask.
+  *
+  */
+constexpr uint8_t field_shift(uint8_t mask) noexcept
+{
+  uint8_t shift = 0U;
+
+  while ((mask & (1U << shift)) == 0U)
+  {
+    shift++;
+  }
+
+  return shift;
+}
+
+/**
+  * @brief  Register field descriptor: register address, bit mask and
+  *         position, all resolved at compile time.
+  *
+  */
+template <uint8_t Reg, uint8_t Mask>
+struct field
+{
+  static_assert(Mask != 0U, "empty field mask");
+
+  static constexpr uint8_t reg = Reg;
+  static constexpr uint8_t mask = Mask;
+  static constexpr uint8_t shift = field_shift(Mask);
+};
+
+/** Fields of the register structures of i3g4250d_reg.h **/
+namespace fld
+{
+using pd       = field<I3G4250D_CTRL_REG1, 0x0FU>;  /* xen yen zen pd */
+using bw       = field<I3G4250D_CTRL_REG1, 0x30U>;
+using dr       = field<I3G4250D_CTRL_REG1, 0xC0U>;
+using hpcf     = field<I3G4250D_CTRL_REG2, 0x0FU>;
+using hpm      = field<I3G4250D_CTRL_REG2, 0x30U>;
+using i2_wtm   = field<I3G4250D_CTRL_REG3, 0x04U>;
+using i2_drdy  = field<I3G4250D_CTRL_REG3, 0x08U>;
+using sim      = field<I3G4250D_CTRL_REG4, 0x01U>;
+using st       = field<I3G4250D_CTRL_REG4, 0x06U>;
+using fs       = field<I3G4250D_CTRL_REG4, 0x30U>;
+using ble      = field<I3G4250D_CTRL_REG4, 0x40U>;
+using out_sel  = field<I3G4250D_CTRL_REG5, 0x03U>;
+using hpen     = field<I3G4250D_CTRL_REG5, 0x10U>;
+using fifo_en  = field<I3G4250D_CTRL_REG5, 0x40U>;
+using boot     = field<I3G4250D_CTRL_REG5, 0x80U>;
+using wtm      = field<I3G4250D_FIFO_CTRL_REG, 0x1FU>;
+using fm       = field<I3G4250D_FIFO_CTRL_REG, 0xE0U>;
+} /* namespace fld */
+
+/**
+  * @brief  C structure of i3g4250d_reg.h mapping each register, for
+  *         read<Reg>() and write<Reg>().
+  *
+  */
+template <uint8_t Reg> struct reg_type;
+template <> struct reg_type<I3G4250D_CTRL_REG1>
+{ using type = i3g4250d_ctrl_reg1_t; };
+template <> struct reg_type<I3G4250D_CTRL_REG2>
+{ using type = i3g4250d_ctrl_reg2_t; };
+template <> struct reg_type<I3G4250D_CTRL_REG3>
+{ using type = i3g4250d_ctrl_reg3_t; };
+template <> struct reg_type<I3G4250D_CTRL_REG4>
+{ using type = i3g4250d_ctrl_reg4_t; };
+template <> struct reg_type<I3G4250D_CTRL_REG5>
+{ using type = i3g4250d_ctrl_reg5_t; };
+template <> struct reg_type<I3G4250D_REFERENCE>
+{ using type = i3g4250d_reference_t; };
+template <> struct reg_type<I3G4250D_STATUS_REG>
+{ using type = i3g4250d_status_reg_t; };
+template <> struct reg_type<I3G4250D_FIFO_CTRL_REG>
+{ using type = i3g4250d_fifo_ctrl_reg_t; };
+template <> struct reg_type<I3G4250D_FIFO_SRC_REG>
+{ using type = i3g4250d_fifo_src_reg_t; };
+template <> struct reg_type<I3G4250D_INT1_CFG>
+{ using type = i3g4250d_int1_cfg_t; };
+template <> struct reg_type<I3G4250D_INT1_SRC>
+{ using type = i3g4250d_int1_src_t; };
+template <> struct reg_type<I3G4250D_INT1_DURATION>
+{ using type = i3g4250d_int1_duration_t; };
+
+template <uint8_t Reg>
+using reg_t = typename reg_type<Reg>::type;
+
+/**
+  * @brief  Bus policy over a stmdev_ctx_t: the accesses go through the
+  *         C generic register routines, so the features declared in the
+  *         driver private data (auto-increment, retry policy, locks,
+  *         register shadow) apply, at the cost of the indirect calls.
+  *
+  *         A bus policy is any copyable type providing:
+  *         - auto_increment: bit set by device<> in the sub-address of
+  *           multi-byte transfers (I3G4250D_I2C_AUTO_INCREMENT,
+  *           I3G4250D_SPI_AUTO_INCREMENT, or 0 when the bus does it);
+  *         - int32_t read(uint8_t reg, uint8_t *data, uint16_t len);
+  *         - int32_t write(uint8_t reg, const uint8_t *data,
+  *           uint16_t len);
+  *         returning 0 -> no Error, as the platform functions.
+  *
+  */
+class ctx_bus
+{
+public:
+  static constexpr uint8_t auto_increment = 0U;
+
+  explicit ctx_bus(const stmdev_ctx_t *ctx) noexcept : ctx_(ctx) {}
+
+  int32_t read(uint8_t reg, uint8_t *data, uint16_t len) const noexcept
+  {
+    return i3g4250d_read_reg(ctx_, reg, data, len);
+  }
+
+  int32_t write(uint8_t reg, const uint8_t *data,
+                uint16_t len) const noexcept
+  {
+    return i3g4250d_write_reg(ctx_, reg, const_cast<uint8_t *>(data), len);
+  }
+
+private:
+  const stmdev_ctx_t *ctx_;
+};
+
+/**
+  * @brief  Device bound to the bus policy Bus. The policy is held by
+  *         value and called directly: with its read / write visible
+  *         to the compiler every API inlines to straight-line code
+  *         around the bus access, without indirect calls.
+  *
+  *         The byte order of the output registers is tracked by
+  *         data_format_set(), from the device reset value (LSB at
+  *         lower address).
+  *
+  */
+template <class Bus>
+class device
+{
+public:
+  explicit device(const Bus &bus) noexcept : bus_(bus) {}
+
+  Bus &bus() noexcept { return bus_; }
+
+  int32_t read_reg(uint8_t reg, uint8_t *data, uint16_t len) noexcept
+  {
+    return bus_.read(sub(reg, len), data, len);
+  }
+
+  int32_t write_reg(uint8_t reg, const uint8_t *data, uint16_t len) noexcept
+  {
+    return bus_.write(sub(reg, len), data, len);
+  }
+
+  /** Register content as its C structure of i3g4250d_reg.h **/
+  template <uint8_t Reg>
+  int32_t read(reg_t<Reg> &val) noexcept
+  {
+    return read_reg(Reg, reinterpret_cast<uint8_t *>(&val), 1U);
+  }
+
+  template <uint8_t Reg>
+  int32_t write(const reg_t<Reg> &val) noexcept
+  {
+    return write_reg(Reg, reinterpret_cast<const uint8_t *>(&val), 1U);
+  }
+
+  /** Field value, right aligned **/
+  template <class F>
+  int32_t get(uint8_t &val) noexcept
+  {
+    uint8_t reg;
+    int32_t ret;
+
+    ret = read_reg(F::reg, &reg, 1U);
+    if (ret != 0) { return ret; }
+
+    val = static_cast<uint8_t>((reg & F::mask) >> F::shift);
+
+    return ret;
+  }
+
+  /** Field update: read-modify-write of its register **/
+  template <class F>
+  int32_t set(uint8_t val) noexcept
+  {
+    return modify(F::reg, F::mask,
+                  static_cast<uint8_t>(val << F::shift));
+  }
+
+  /** Read-modify-write of the bits of "mask" **/
+  int32_t modify(uint8_t reg, uint8_t mask, uint8_t val) noexcept
+  {
+    uint8_t data;
+    int32_t ret;
+
+    ret = read_reg(reg, &data, 1U);
+    if (ret != 0) { return ret; }
+
+    data = static_cast<uint8_t>((data & ~mask) | (val & mask));
+
+    return write_reg(reg, &data, 1U);
+  }
+
+  int32_t device_id_get(uint8_t &val) noexcept
+  {
+    return read_reg(I3G4250D_WHO_AM_I, &val, 1U);
+  }
+
+  /** dr and pd of CTRL_REG1 in a single write, as the C API **/
+  int32_t data_rate_set(i3g4250d_dr_t val) noexcept
+  {
+    const uint8_t v = static_cast<uint8_t>(val);
+
+    return modify(I3G4250D_CTRL_REG1, fld::dr::mask | fld::pd::mask,
+                  static_cast<uint8_t>(((v & 0x30U) << 2) | (v & 0x0FU)));
+  }
+
+  int32_t full_scale_set(i3g4250d_fs_t val) noexcept
+  {
+    return set<fld::fs>(static_cast<uint8_t>(val));
+  }
+
+  int32_t data_format_set(i3g4250d_ble_t val) noexcept
+  {
+    int32_t ret;
+
+    ret = set<fld::ble>(static_cast<uint8_t>(val));
+    if (ret == 0)
+    {
+      swap_ = (static_cast<uint8_t>(val) != host_ble);
+    }
+
+    return ret;
+  }
+
+  int32_t fifo_enable_set(uint8_t val) noexcept
+  {
+    return set<fld::fifo_en>(val);
+  }
+
+  int32_t fifo_watermark_set(uint8_t val) noexcept
+  {
+    return set<fld::wtm>(val);
+  }
+
+  int32_t fifo_mode_set(i3g4250d_fifo_mode_t val) noexcept
+  {
+    return set<fld::fm>(static_cast<uint8_t>(val));
+  }
+
+  /** X, Y, Z output registers, in host byte order **/
+  int32_t angular_rate_raw_get(int16_t *val) noexcept
+  {
+    int32_t ret;
+
+    ret = read_reg(I3G4250D_OUT_X_L, reinterpret_cast<uint8_t *>(val), 6U);
+    if (ret != 0) { return ret; }
+
+    to_host(val, 3U);
+
+    return ret;
+  }
+
+  /**
+    * FIFO_SRC_REG, then the samples stored (up to "max", 1 to
+    * I3G4250D_FIFO_DEPTH) in a single burst, as i3g4250d_fifo_drain
+    *
+    */
+  int32_t fifo_drain(int16_t *val, uint8_t max, uint8_t &num) noexcept
+  {
+    reg_t<I3G4250D_FIFO_SRC_REG> src;
+    uint8_t level;
+    int32_t ret;
+
+    num = 0U;
+
+    if ((max == 0U) || (max > I3G4250D_FIFO_DEPTH)) { return -1; }
+
+    ret = read<I3G4250D_FIFO_SRC_REG>(src);
+    if (ret != 0) { return ret; }
+
+    level = (src.empty != 0U) ? 0U :
+            (src.ovrn != 0U) ? static_cast<uint8_t>(I3G4250D_FIFO_DEPTH) :
+            static_cast<uint8_t>(src.fss);
+    level = (level < max) ? level : max;
+    if (level == 0U) { return ret; }
+
+    ret = read_reg(I3G4250D_OUT_X_L, reinterpret_cast<uint8_t *>(val),
+                   static_cast<uint16_t>(level * 6U));
+    if (ret != 0) { return ret; }
+
+    to_host(val, static_cast<uint16_t>(level * 3U));
+    num = level;
+
+    return ret;
+  }
+
+private:
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  static constexpr uint8_t host_ble = I3G4250D_AUX_LSB_AT_LOW_ADD;
+#else
+  static constexpr uint8_t host_ble = I3G4250D_AUX_MSB_AT_LOW_ADD;
+#endif /* DRV_BYTE_ORDER */
+
+  static constexpr uint8_t sub(uint8_t reg, uint16_t len) noexcept
+  {
+    return (len > 1U) ? static_cast<uint8_t>(reg | Bus::auto_increment) :
+           reg;
+  }
+
+  void to_host(int16_t *val, uint16_t num) const noexcept
+  {
+    uint16_t word;
+    uint16_t i;
+
+    if (!swap_) { return; }
+
+    for (i = 0U; i < num; i++)
+    {
+      std::memcpy(&word, &val[i], sizeof(word));
+      word = static_cast<uint16_t>((word << 8) | (word >> 8));
+      std::memcpy(&val[i], &word, sizeof(word));
+    }
+  }
+
+  Bus bus_;
+  bool swap_ = (I3G4250D_AUX_LSB_AT_LOW_ADD != host_ble);
+};
+
+} /* namespace i3g4250d */
+
+#endif /* I3G4250D_HPP */
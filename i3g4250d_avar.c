@@ -0,0 +1,453 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_avar.c
+  * @author  Sensors Software Solution Team
+  * @brief   Optional streaming overlapping Allan variance of the i3g4250d
+  *          driver, with the noise terms of the gyroscope.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_avar.h"
+#include <string.h>
+
+/**
+  * @addtogroup  I3G4250D
+  * @{
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_allan_variance
+  * @brief      This section groups the streaming overlapping Allan
+  *             variance engine. It works on the phase (running sum) of
+  *             the raw samples, kept as exact 64-bit integers. Cluster
+  *             sizes are octave spaced, m = 2^level; each level keeps a
+  *             ring of phase points decimated so that the overlap
+  *             factor is 2^I3G4250D_AVAR_OVERLAP, which bounds memory
+  *             whatever the recording length. Phase points sit at
+  *             sample indices of the whole recording that are multiples
+  *             of the level stride, so that engines of consecutive chunks
+  *             merge into exactly the result of sequential processing.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Phase point stride of a level, as a power of two.
+  *
+  */
+static uint8_t i3g4250d_avar_shift(uint8_t level)
+{
+  return (level > I3G4250D_AVAR_OVERLAP) ?
+         (uint8_t)(level - I3G4250D_AVAR_OVERLAP) : 0U;
+}
+
+/**
+  * @brief  Points spanned by one term of a level, ie. cluster size
+  *         in points.
+  *
+  */
+static uint32_t i3g4250d_avar_span(uint8_t level)
+{
+  return 1UL << (level - i3g4250d_avar_shift(level));
+}
+
+/**
+  * @brief  Accumulate one second difference of the phase.
+  *
+  */
+static void i3g4250d_avar_term(i3g4250d_avar_level_t *lvl,
+                               const int64_t *x0, const int64_t *x1,
+                               const int64_t *x2)
+{
+  int64_t d;
+  uint8_t a;
+
+  for (a = 0U; a < 3U; a++)
+  {
+    d = x2[a] - (2 * x1[a]) + x0[a];
+    lvl->d2[a] += (double)d * (double)d;
+  }
+
+  lvl->terms++;
+}
+
+/**
+  * @brief  Push a phase point into a level.
+  *
+  */
+static void i3g4250d_avar_push(i3g4250d_avar_level_t *lvl, uint8_t level,
+                               const int64_t *x)
+{
+  uint32_t m = i3g4250d_avar_span(level);
+  uint32_t r = (2U * m) + 1U;
+
+  if (lvl->head_len < r)
+  {
+    (void)memcpy(lvl->head[lvl->head_len], x, 3U * sizeof(int64_t));
+    lvl->head_len++;
+  }
+
+  (void)memcpy(lvl->tail[lvl->pos], x, 3U * sizeof(int64_t));
+  lvl->pos = (lvl->pos + 1U) % r;
+
+  if (lvl->len < r)
+  {
+    lvl->len++;
+  }
+
+  if (lvl->len == r)
+  {
+    i3g4250d_avar_term(lvl, lvl->tail[lvl->pos],
+                       lvl->tail[(lvl->pos + m) % r],
+                       lvl->tail[(lvl->pos + r - 1U) % r]);
+  }
+}
+
+/**
+  * @brief  Phase origin of a chunk is a point of the level.
+  *
+  */
+static uint8_t i3g4250d_avar_origin_on_grid(const i3g4250d_avar_t *av,
+                                            uint8_t level)
+{
+  uint64_t stride = 1ULL << i3g4250d_avar_shift(level);
+
+  return ((av->start & (stride - 1U)) == 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Allan variance engine initialization for a chunk of a
+  *         recording, to be merged with i3g4250d_avar_merge.
+  *
+  * @param  av     Allan variance instance.(ptr)
+  * @param  odr    Sample rate [Hz]
+  * @param  sens   Sensitivity [mdps/LSB] of the recording full scale
+  * @param  first  Index of the first sample of the chunk in the
+  *                recording
+  *
+  */
+void i3g4250d_avar_chunk_init(i3g4250d_avar_t *av, float_t odr,
+                              float_t sens, uint64_t first)
+{
+  uint8_t l;
+
+  (void)memset(av, 0, sizeof(i3g4250d_avar_t));
+  av->tau0 = 1.0f / odr;
+  av->sens = sens / 1000.0f;
+  av->start = first;
+
+  /* phase origin, on the levels whose stride divides its index */
+  for (l = 0U; (l < I3G4250D_AVAR_LEVELS) &&
+       (i3g4250d_avar_origin_on_grid(av, l) != 0U); l++)
+  {
+    i3g4250d_avar_push(&av->lvl[l], l, av->phase);
+  }
+}
+
+/**
+  * @brief  Allan variance engine initialization.
+  *
+  * @param  av     Allan variance instance.(ptr)
+  * @param  odr    Sample rate [Hz]
+  * @param  sens   Sensitivity [mdps/LSB] of the recording full scale
+  *
+  */
+void i3g4250d_avar_init(i3g4250d_avar_t *av, float_t odr, float_t sens)
+{
+  i3g4250d_avar_chunk_init(av, odr, sens, 0U);
+}
+
+/**
+  * @brief  Allan variance engine update with a block of samples.
+  *
+  * @param  av     Allan variance instance.(ptr)
+  * @param  val    Raw samples, X Y Z interleaved.(ptr)
+  * @param  num    Number of samples
+  *
+  */
+void i3g4250d_avar_update(i3g4250d_avar_t *av, const int16_t *val,
+                          uint32_t num)
+{
+  uint64_t stride;
+  uint32_t n;
+  uint8_t l;
+  uint8_t a;
+
+  for (n = 0U; n < num; n++)
+  {
+    for (a = 0U; a < 3U; a++)
+    {
+      av->phase[a] += (int64_t)val[(3U * n) + a];
+    }
+
+    av->samples++;
+
+    for (l = 0U; l < I3G4250D_AVAR_LEVELS; l++)
+    {
+      stride = 1ULL << i3g4250d_avar_shift(l);
+
+      if (((av->start + av->samples) & (stride - 1U)) != 0U)
+      {
+        /* larger strides are not due either */
+        break;
+      }
+
+      i3g4250d_avar_push(&av->lvl[l], l, av->phase);
+    }
+  }
+}
+
+/**
+  * @brief  Merge the engine of the following chunk of a recording into
+  *         the engine of the preceding one, so that chunks can be
+  *         processed in parallel. Terms straddling the boundary are
+  *         rebuilt from the ring of the preceding chunk and the first
+  *         points of the following one. Both engines place their
+  *         points on the grid of the whole recording (see
+  *         i3g4250d_avar_chunk_init), so the result equals sequential
+  *         processing whatever the chunk lengths.
+  *
+  * @param  dst    Engine of the preceding chunk, updated.(ptr)
+  * @param  src    Engine of the following chunk.(ptr)
+  * @retval        0: done; -1: src doesn't start right after dst, or
+  *                a different sample rate
+  *
+  */
+int32_t i3g4250d_avar_merge(i3g4250d_avar_t *dst,
+                            const i3g4250d_avar_t *src)
+{
+  int64_t pts[2U * I3G4250D_AVAR_POINTS][3];
+  i3g4250d_avar_level_t *d;
+  const i3g4250d_avar_level_t *s;
+  uint32_t m;
+  uint32_t r;
+  uint32_t len;
+  uint32_t last;
+  uint32_t i;
+  uint8_t origin;
+  uint8_t l;
+  uint8_t a;
+
+  if (((dst->start + dst->samples) != src->start) ||
+      (dst->tau0 != src->tau0))
+  {
+    return -1;
+  }
+
+  for (l = 0U; l < I3G4250D_AVAR_LEVELS; l++)
+  {
+    d = &dst->lvl[l];
+    s = &src->lvl[l];
+    m = i3g4250d_avar_span(l);
+    r = (2U * m) + 1U;
+    origin = i3g4250d_avar_origin_on_grid(src, l);
+
+    /* points of dst, oldest first, then the first points of src */
+    len = 0U;
+
+    for (i = 0U; i < d->len; i++)
+    {
+      (void)memcpy(pts[len], d->tail[(d->pos + r - d->len + i) % r],
+                   sizeof(pts[0]));
+      len++;
+    }
+
+    /* the origin of src, when on the grid, is the last point of dst */
+    for (i = origin; i < s->head_len; i++)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        pts[len][a] = s->head[i][a] + dst->phase[a];
+      }
+
+      len++;
+    }
+
+    /* terms from a point of dst to a point of src; those starting on
+       the shared origin were already computed by src */
+    last = (d->len > origin) ? (d->len - origin) : 0U;
+
+    for (i = 0U; (i < last) && ((i + (2U * m)) < len); i++)
+    {
+      if ((i + (2U * m)) >= d->len)
+      {
+        i3g4250d_avar_term(d, pts[i], pts[i + m], pts[i + (2U * m)]);
+      }
+    }
+
+    for (a = 0U; a < 3U; a++)
+    {
+      d->d2[a] += s->d2[a];
+    }
+
+    d->terms += s->terms;
+
+    if (d->head_len < r)
+    {
+      d->head_len = (len < r) ? len : r;
+      (void)memcpy(d->head, pts, d->head_len * sizeof(pts[0]));
+    }
+
+    if (s->len == r)
+    {
+      for (i = 0U; i < r; i++)
+      {
+        for (a = 0U; a < 3U; a++)
+        {
+          pts[i][a] = s->tail[(s->pos + i) % r][a] + dst->phase[a];
+        }
+      }
+
+      len = r;
+    }
+
+    else if (len > r)
+    {
+      (void)memmove(pts, pts[len - r], r * sizeof(pts[0]));
+      len = r;
+    }
+
+    else
+    {
+      /* all points already in place */
+    }
+
+    (void)memcpy(d->tail, pts, len * sizeof(pts[0]));
+    d->len = len;
+    d->pos = len % r;
+  }
+
+  for (a = 0U; a < 3U; a++)
+  {
+    dst->phase[a] += src->phase[a];
+  }
+
+  dst->samples += src->samples;
+
+  return 0;
+}
+
+/**
+  * @brief  Allan deviation at a cluster size.[get]
+  *
+  * @param  av     Allan variance instance.(ptr)
+  * @param  level  Level, cluster time tau = 2^level / ODR
+  * @param  tau    Cluster time [s].(ptr)
+  * @param  val    Allan deviation on X, Y, Z [dps].(ptr)
+  * @retval        0: done; -1: recording shorter than two clusters
+  *
+  */
+int32_t i3g4250d_avar_get(const i3g4250d_avar_t *av, uint8_t level,
+                          float_t *tau, float_t *val)
+{
+  const i3g4250d_avar_level_t *lvl;
+  double m;
+  uint8_t a;
+
+  if ((level >= I3G4250D_AVAR_LEVELS) || (av->lvl[level].terms == 0U))
+  {
+    return -1;
+  }
+
+  lvl = &av->lvl[level];
+  m = (double)(1UL << level);
+  *tau = av->tau0 * (float_t)m;
+
+  for (a = 0U; a < 3U; a++)
+  {
+    val[a] = (float_t)sqrt(lvl->d2[a] /
+                           (2.0 * m * m * (double)lvl->terms)) * av->sens;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Noise parameters from the Allan deviation curve.[get]
+  *         Angle random walk is read on the curve at the cluster time
+  *         closest to 1 s (white noise slope assumed there); bias
+  *         instability is the curve minimum divided by 0.664. Cluster
+  *         sizes fitting less than I3G4250D_AVAR_MIN_CLUSTERS times in
+  *         the recording are not used.
+  *
+  * @param  av     Allan variance instance.(ptr)
+  * @param  val    Noise parameters per axis.(ptr)
+  * @retval        0: done; -1: recording too short
+  *
+  */
+int32_t i3g4250d_avar_noise_get(const i3g4250d_avar_t *av,
+                                i3g4250d_avar_noise_t *val)
+{
+  float_t adev[3];
+  float_t tau;
+  float_t best = 0.0f;
+  float_t dist;
+  uint8_t l;
+  uint8_t a;
+  int32_t ret = -1;
+
+  for (l = 0U; l < I3G4250D_AVAR_LEVELS; l++)
+  {
+    if (((av->samples >> l) < I3G4250D_AVAR_MIN_CLUSTERS) ||
+        (i3g4250d_avar_get(av, l, &tau, adev) != 0))
+    {
+      continue;
+    }
+
+    dist = fabsf(logf(tau));
+
+    for (a = 0U; a < 3U; a++)
+    {
+      if ((ret != 0) || (adev[a] < val->bias_instability[a]))
+      {
+        val->bias_instability[a] = adev[a];
+      }
+
+      if ((ret != 0) || (dist < best))
+      {
+        /* deg/s * sqrt(s) -> deg/sqrt(h) */
+        val->arw[a] = adev[a] * sqrtf(tau) * 60.0f;
+      }
+    }
+
+    if ((ret != 0) || (dist < best))
+    {
+      best = dist;
+    }
+
+    ret = 0;
+  }
+
+  if (ret == 0)
+  {
+    for (a = 0U; a < 3U; a++)
+    {
+      /* deg/s -> deg/h */
+      val->bias_instability[a] = (val->bias_instability[a] / 0.664f) *
+                                 3600.0f;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
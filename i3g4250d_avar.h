@@ -0,0 +1,91 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_avar.h
+  * @author  Sensors Software Solution Team
+  * @brief   Optional streaming overlapping Allan variance of the i3g4250d
+  *          driver, with the noise terms of the gyroscope.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_AVAR_H
+#define I3G4250D_AVAR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "i3g4250d_reg.h"
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+#ifndef I3G4250D_AVAR_LEVELS
+#define I3G4250D_AVAR_LEVELS             24U
+#endif /* I3G4250D_AVAR_LEVELS */
+#ifndef I3G4250D_AVAR_OVERLAP
+#define I3G4250D_AVAR_OVERLAP            3U
+#endif /* I3G4250D_AVAR_OVERLAP */
+#define I3G4250D_AVAR_POINTS             ((2U << I3G4250D_AVAR_OVERLAP) + 1U)
+#define I3G4250D_AVAR_MIN_CLUSTERS       9U
+typedef struct
+{
+  int64_t tail[I3G4250D_AVAR_POINTS][3]; /* ring of the last phase points */
+  int64_t head[I3G4250D_AVAR_POINTS][3]; /* first phase points */
+  double d2[3];               /* sum of squared second differences */
+  uint32_t terms;
+  uint32_t pos;
+  uint32_t len;
+  uint32_t head_len;
+} i3g4250d_avar_level_t;
+
+typedef struct
+{
+  i3g4250d_avar_level_t lvl[I3G4250D_AVAR_LEVELS];
+  int64_t phase[3];
+  uint64_t start;             /* index of the first sample in the record */
+  uint64_t samples;
+  float_t tau0;
+  float_t sens;               /* [dps/LSB] */
+} i3g4250d_avar_t;
+
+typedef struct
+{
+  float_t arw[3];             /* angle random walk [deg/sqrt(h)] */
+  float_t bias_instability[3]; /* [deg/h] */
+} i3g4250d_avar_noise_t;
+void i3g4250d_avar_init(i3g4250d_avar_t *av, float_t odr, float_t sens);
+void i3g4250d_avar_chunk_init(i3g4250d_avar_t *av, float_t odr,
+                              float_t sens, uint64_t first);
+void i3g4250d_avar_update(i3g4250d_avar_t *av, const int16_t *val,
+                          uint32_t num);
+int32_t i3g4250d_avar_merge(i3g4250d_avar_t *dst,
+                            const i3g4250d_avar_t *src);
+int32_t i3g4250d_avar_get(const i3g4250d_avar_t *av, uint8_t level,
+                          float_t *tau, float_t *val);
+int32_t i3g4250d_avar_noise_get(const i3g4250d_avar_t *av,
+                                i3g4250d_avar_noise_t *val);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_AVAR_H */
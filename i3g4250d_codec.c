@@ -0,0 +1,328 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_codec.c
+  * @author  Sensors Software Solution Team
+  * @brief   Optional lossless codec of the i3g4250d driver for blocks of
+  *          raw samples.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_codec.h"
+
+/**
+  * @addtogroup  I3G4250D
+  * @{
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_codec
+  * @brief      This section groups the lossless codec for blocks of raw
+  *             X Y Z samples. Each axis is delta coded, the deltas are
+  *             zigzag mapped to unsigned values and bit-packed with the
+  *             smallest width that fits the whole axis of the block.
+  *             Zigzag mapping is branch-free; the packing loops branch
+  *             on the bit count, which depends on the axis width only,
+  *             not on the sample values. The CRC is table driven.
+  *             Encoded block: number of samples (2 bytes), first sample
+  *             of each axis (3 x 2 bytes), width of each axis (3 bytes),
+  *             then the packed deltas of X, Y and Z, LSB first, and the
+  *             CRC-16/CCITT of all the previous bytes (2 bytes).
+  * @{
+  *
+  */
+
+/**
+  * @brief  Store a little-endian field.
+  *
+  * @param  buf   destination(ptr)
+  * @param  val   value
+  * @param  len   field size in bytes
+  *
+  */
+static void i3g4250d_le_put(uint8_t *buf, uint64_t val, uint8_t len)
+{
+  uint8_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    buf[i] = (uint8_t)(val >> (8U * i));
+  }
+}
+
+/**
+  * @brief  Load a little-endian field.
+  *
+  * @param  buf   source(ptr)
+  * @param  len   field size in bytes
+  * @retval       value
+  *
+  */
+static uint64_t i3g4250d_le_get(const uint8_t *buf, uint8_t len)
+{
+  uint64_t val = 0U;
+  uint8_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    val |= (uint64_t)buf[i] << (8U * i);
+  }
+
+  return val;
+}
+
+/**
+  * @brief  Zigzag mapped delta between two consecutive samples.
+  *
+  * @param  cur   current sample
+  * @param  prev  previous sample
+  * @retval       zigzag value (up to 17 bits)
+  *
+  */
+static uint32_t i3g4250d_zigzag(int16_t cur, int16_t prev)
+{
+  uint32_t d = (uint32_t)((int32_t)cur - (int32_t)prev);
+
+  /* 2d for d >= 0, -2d - 1 otherwise */
+  return (d << 1) ^ (0U - (d >> 31));
+}
+
+/**
+  * @brief  CRC-16/CCITT of each byte value.
+  *
+  */
+static const uint16_t i3g4250d_crc16_lut[256] =
+{
+  0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+  0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+  0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+  0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+  0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+  0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+  0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+  0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+  0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+  0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+  0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+  0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+  0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+  0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+  0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+  0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+  0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+  0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+  0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+  0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+  0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+  0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+  0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+  0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+  0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+  0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+  0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+  0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+  0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+  0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+  0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+  0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+};
+
+/**
+  * @brief  CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF).
+  *
+  * @param  buf   Data.(ptr)
+  * @param  len   Number of bytes
+  * @retval       CRC
+  *
+  */
+static uint16_t i3g4250d_crc16(const uint8_t *buf, uint32_t len)
+{
+  uint16_t crc = 0xFFFFU;
+  uint32_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    crc = (uint16_t)((uint16_t)(crc << 8) ^
+                     i3g4250d_crc16_lut[(uint8_t)(crc >> 8) ^ buf[i]]);
+  }
+
+  return crc;
+}
+
+/**
+  * @brief  Encode a block of samples.
+  *
+  * @param  val   Raw samples, X Y Z interleaved.(ptr)
+  * @param  num   Number of samples
+  * @param  out   Encoded block, I3G4250D_CODEC_MAX_SIZE(num) bytes at
+  *               most.(ptr)
+  * @retval       Size of the encoded block [byte]
+  *
+  */
+uint32_t i3g4250d_codec_encode(const int16_t *val, uint16_t num, uint8_t *out)
+{
+  uint64_t acc = 0U;
+  uint32_t size = I3G4250D_CODEC_HEADER_SIZE;
+  uint32_t mask;
+  uint32_t zz;
+  uint16_t n;
+  uint8_t bits = 0U;
+  uint8_t width;
+  uint8_t a;
+
+  i3g4250d_le_put(&out[0], num, 2U);
+
+  for (a = 0U; a < 3U; a++)
+  {
+    mask = 0U;
+    for (n = 1U; n < num; n++)
+    {
+      mask |= i3g4250d_zigzag(val[(3U * n) + a], val[(3U * (n - 1U)) + a]);
+    }
+
+    width = 0U;
+    while (mask != 0U)
+    {
+      width++;
+      mask >>= 1;
+    }
+
+    i3g4250d_le_put(&out[2U + (2U * a)], (num > 0U) ? (uint16_t)val[a] : 0U,
+                    2U);
+    out[8U + a] = width;
+
+    for (n = 1U; n < num; n++)
+    {
+      zz = i3g4250d_zigzag(val[(3U * n) + a], val[(3U * (n - 1U)) + a]);
+      acc |= (uint64_t)zz << bits;
+      bits += width;
+
+      while (bits >= 8U)
+      {
+        out[size] = (uint8_t)acc;
+        size++;
+        acc >>= 8;
+        bits = (uint8_t)(bits - 8U);
+      }
+    }
+  }
+
+  if (bits > 0U)
+  {
+    out[size] = (uint8_t)acc;
+    size++;
+  }
+
+  i3g4250d_le_put(&out[size], i3g4250d_crc16(out, size), 2U);
+  size += I3G4250D_CODEC_CRC_SIZE;
+
+  return size;
+}
+
+/**
+  * @brief  Decode a block of samples.
+  *
+  * @param  in    Encoded block.(ptr)
+  * @param  len   Size of the encoded block [byte]
+  * @param  val   Raw samples, X Y Z interleaved.(ptr)
+  * @param  max   Capacity of val [samples]
+  * @param  num   Number of samples decoded.(ptr)
+  * @retval       0: done; -1: corrupted (CRC mismatch) or truncated
+  *               block, or more than max samples
+  *
+  */
+int32_t i3g4250d_codec_decode(const uint8_t *in, uint32_t len, int16_t *val,
+                              uint16_t max, uint16_t *num)
+{
+  uint64_t acc = 0U;
+  uint32_t pos = I3G4250D_CODEC_HEADER_SIZE;
+  uint32_t need = 0U;
+  uint32_t zz;
+  uint32_t mask;
+  int32_t cur;
+  uint16_t cnt;
+  uint16_t n;
+  uint8_t bits = 0U;
+  uint8_t width;
+  uint8_t a;
+
+  if (len < (I3G4250D_CODEC_HEADER_SIZE + I3G4250D_CODEC_CRC_SIZE))
+  {
+    return -1;
+  }
+
+  cnt = (uint16_t)i3g4250d_le_get(&in[0], 2U);
+  if (cnt > max) { return -1; }
+
+  for (a = 0U; a < 3U; a++)
+  {
+    if (in[8U + a] > 17U) { return -1; }
+    if (cnt > 0U)
+    {
+      need += (uint32_t)in[8U + a] * (cnt - 1U);
+    }
+  }
+
+  need = pos + ((need + 7U) / 8U);
+  if ((need + I3G4250D_CODEC_CRC_SIZE) > len) { return -1; }
+
+  if (i3g4250d_crc16(in, need) !=
+      (uint16_t)i3g4250d_le_get(&in[need], 2U))
+  {
+    return -1;
+  }
+
+  for (a = 0U; a < 3U; a++)
+  {
+    width = in[8U + a];
+    mask = (uint32_t)((1UL << width) - 1U);
+    cur = (int16_t)i3g4250d_le_get(&in[2U + (2U * a)], 2U);
+
+    if (cnt > 0U)
+    {
+      val[a] = (int16_t)cur;
+    }
+
+    for (n = 1U; n < cnt; n++)
+    {
+      while (bits < width)
+      {
+        acc |= (uint64_t)in[pos] << bits;
+        pos++;
+        bits += 8U;
+      }
+
+      zz = (uint32_t)acc & mask;
+      acc >>= width;
+      bits -= width;
+
+      /* zz / 2 for even zz, -(zz + 1) / 2 otherwise */
+      cur += (int32_t)((zz >> 1) ^ (0U - (zz & 1U)));
+      val[(3U * n) + a] = (int16_t)cur;
+    }
+  }
+
+  *num = cnt;
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
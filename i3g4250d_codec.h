@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_codec.h
+  * @author  Sensors Software Solution Team
+  * @brief   Optional lossless codec of the i3g4250d driver for blocks of
+  *          raw samples.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_CODEC_H
+#define I3G4250D_CODEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "i3g4250d_reg.h"
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+#define I3G4250D_CODEC_HEADER_SIZE       11U
+#define I3G4250D_CODEC_CRC_SIZE          2U
+#define I3G4250D_CODEC_MAX_SIZE(num) \
+  (I3G4250D_CODEC_HEADER_SIZE + ((((uint32_t)(num) * 51U) + 7U) / 8U) + \
+   I3G4250D_CODEC_CRC_SIZE)
+uint32_t i3g4250d_codec_encode(const int16_t *val, uint16_t num,
+                               uint8_t *out);
+int32_t i3g4250d_codec_decode(const uint8_t *in, uint32_t len, int16_t *val,
+                              uint16_t max, uint16_t *num);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_CODEC_H */
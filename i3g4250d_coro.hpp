@@ -0,0 +1,217 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_coro.hpp
+  * @author  Sensors Software Solution Team
+  * @brief   C++20 awaiters over the asynchronous functions of the
+  *          i3g4250d_reg.c driver (optional, header only).
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_CORO_HPP
+#define I3G4250D_CORO_HPP
+
+/* Includes ------------------------------------------------------------------*/
+#include <atomic>
+#include <coroutine>
+#include "i3g4250d_reg.h"
+
+namespace i3g4250d
+{
+
+/**
+  * @brief  Suspension handshake shared by the awaiters. The transfer
+  *         completion may run from within the request, later from an
+  *         event loop, or on another thread: of await_suspend and the
+  *         completion, the second one to get there resumes the
+  *         coroutine. Once the request is issued the awaiter belongs
+  *         to the completion and is not touched by await_suspend.
+  *
+  */
+class completion
+{
+public:
+  completion() noexcept = default;
+  completion(const completion &) = delete;
+  completion &operator=(const completion &) = delete;
+
+  bool await_ready() const noexcept { return false; }
+
+  /** Completion callback (i3g4250d_async_done_t), arg: the awaiter **/
+  static void done(void *arg, int32_t status) noexcept
+  {
+    completion *c = static_cast<completion *>(arg);
+
+    c->status_ = status;
+    if (c->flag_.exchange(true, std::memory_order_acq_rel))
+    {
+      c->handle_.resume();
+    }
+  }
+
+protected:
+  void *arg() noexcept { return static_cast<completion *>(this); }
+
+  void arm(std::coroutine_handle<> h) noexcept { handle_ = h; }
+
+  /** @retval true: suspended until the completion **/
+  bool issued(int32_t ret) noexcept
+  {
+    if (ret != 0)
+    {
+      /* not issued: no completion will come */
+      status_ = ret;
+      return false;
+    }
+
+    return !flag_.exchange(true, std::memory_order_acq_rel);
+  }
+
+  int32_t status() const noexcept { return status_; }
+
+private:
+  std::coroutine_handle<> handle_;
+  std::atomic<bool> flag_{false};
+  int32_t status_ = 0;
+};
+
+/**
+  * @brief  co_await read_reg(...): asynchronous register read.
+  *         Result: interface status (0 -> no Error).
+  *
+  */
+class read_reg : public completion
+{
+public:
+  read_reg(const stmdev_ctx_t *ctx, const i3g4250d_async_if_t *bus,
+           uint8_t reg, uint8_t *data, uint16_t len) noexcept
+    : ctx_(ctx), bus_(bus), data_(data), len_(len), reg_(reg) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept
+  {
+    arm(h);
+    return issued(i3g4250d_read_reg_async(ctx_, bus_, reg_, data_, len_,
+                                          &completion::done, arg()));
+  }
+
+  int32_t await_resume() const noexcept { return status(); }
+
+private:
+  const stmdev_ctx_t *ctx_;
+  const i3g4250d_async_if_t *bus_;
+  uint8_t *data_;
+  uint16_t len_;
+  uint8_t reg_;
+};
+
+/**
+  * @brief  co_await write_reg(...): asynchronous register write, data
+  *         kept by the caller until resumed.
+  *         Result: interface status (0 -> no Error).
+  *
+  */
+class write_reg : public completion
+{
+public:
+  write_reg(const stmdev_ctx_t *ctx, const i3g4250d_async_if_t *bus,
+            uint8_t reg, uint8_t *data, uint16_t len) noexcept
+    : ctx_(ctx), bus_(bus), data_(data), len_(len), reg_(reg) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept
+  {
+    arm(h);
+    return issued(i3g4250d_write_reg_async(ctx_, bus_, reg_, data_, len_,
+                                           &completion::done, arg()));
+  }
+
+  int32_t await_resume() const noexcept { return status(); }
+
+private:
+  const stmdev_ctx_t *ctx_;
+  const i3g4250d_async_if_t *bus_;
+  uint8_t *data_;
+  uint16_t len_;
+  uint8_t reg_;
+};
+
+/**
+  * @brief  co_await modify_reg(...): asynchronous read-modify-write of
+  *         the bits of "mask" (see i3g4250d_modify_reg_async).
+  *         Result: interface status (0 -> no Error); data() holds the
+  *         register content written.
+  *
+  */
+class modify_reg : public completion
+{
+public:
+  modify_reg(const stmdev_ctx_t *ctx, const i3g4250d_async_if_t *bus,
+             uint8_t reg, uint8_t mask, uint8_t val) noexcept
+    : ctx_(ctx), bus_(bus), reg_(reg), mask_(mask), val_(val) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept
+  {
+    arm(h);
+    return issued(i3g4250d_modify_reg_async(&op_, ctx_, bus_, reg_, mask_,
+                                            val_, &completion::done, arg()));
+  }
+
+  int32_t await_resume() const noexcept { return status(); }
+
+  uint8_t data() const noexcept { return op_.data; }
+
+private:
+  i3g4250d_modify_op_t op_{};
+  const stmdev_ctx_t *ctx_;
+  const i3g4250d_async_if_t *bus_;
+  uint8_t reg_;
+  uint8_t mask_;
+  uint8_t val_;
+};
+
+/**
+  * @brief  co_await fifo_drain(...): asynchronous FIFO drain of up to
+  *         "max" samples (see i3g4250d_fifo_drain_async).
+  *         Result: number of samples read, or the negative interface
+  *         status on error.
+  *
+  */
+class fifo_drain : public completion
+{
+public:
+  fifo_drain(const stmdev_ctx_t *ctx, const i3g4250d_async_if_t *bus,
+             int16_t *val, uint8_t max) noexcept
+    : ctx_(ctx), bus_(bus), val_(val), max_(max) {}
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept
+  {
+    arm(h);
+    return issued(i3g4250d_fifo_drain_async(&op_, ctx_, bus_, val_, max_,
+                                            &completion::done, arg()));
+  }
+
+  int32_t await_resume() const noexcept
+  {
+    return (status() != 0) ? status() : static_cast<int32_t>(op_.num);
+  }
+
+private:
+  i3g4250d_fifo_drain_op_t op_{};
+  const stmdev_ctx_t *ctx_;
+  const i3g4250d_async_if_t *bus_;
+  int16_t *val_;
+  uint8_t max_;
+};
+
+} /* namespace i3g4250d */
+
+#endif /* I3G4250D_CORO_HPP */
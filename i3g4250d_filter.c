@@ -0,0 +1,421 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_filter.c
+  * @author  Sensors Software Solution Team
+  * @brief   Optional post-filters of the i3g4250d driver: biquad, moving
+  *          average and CIC decimator.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_filter.h"
+#include <string.h>
+
+#define I3G4250D_PI                      3.14159265f
+
+/* Samples converted at once into padded lanes, then run through each
+   stage in turn (16 x 4 lanes of 4 bytes: 256 bytes of stack) */
+#define I3G4250D_FLT_BLOCK               16U
+
+/**
+  * @addtogroup  I3G4250D
+  * @{
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_post_filters
+  * @brief      This section groups the digital post-filters that run on
+  *             blocks of X, Y, Z interleaved raw samples, as read from the
+  *             FIFO. The filter state is stored per axis in adjacent
+  *             lanes (structure of arrays), padded to four lanes
+  *             (I3G4250D_FLT_LANES). Samples are processed by blocks of
+  *             I3G4250D_FLT_BLOCK, converted first into padded lanes and
+  *             then run through each stage in turn: the inner loops over
+  *             the axes have a constant trip count of one 128-bit vector
+  *             and are vectorized by the compiler (GCC -O2, SSE2 or
+  *             NEON), and the stage state stays in registers.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Biquad coefficients (RBJ audio EQ cookbook), normalized
+  *         with a0 = 1.
+  *
+  * @param  type   Low-pass or high-pass response
+  * @param  fc     Cut-off frequency [Hz]
+  * @param  odr    Sample rate [Hz]
+  * @param  q      Quality factor (0.7071 for Butterworth)
+  * @param  coef   Computed coefficients.(ptr)
+  * @retval        0: coefficients computed; -1: invalid frequency or q
+  *
+  */
+int32_t i3g4250d_biquad_coef_get(i3g4250d_biquad_type_t type, float_t fc,
+                                 float_t odr, float_t q,
+                                 i3g4250d_biquad_coef_t *coef)
+{
+  float_t w0;
+  float_t cw;
+  float_t alpha;
+  float_t a0_inv;
+
+  if ((fc <= 0.0f) || (odr <= (2.0f * fc)) || (q <= 0.0f)) { return -1; }
+
+  w0 = 2.0f * I3G4250D_PI * fc / odr;
+  cw = cosf(w0);
+  alpha = sinf(w0) / (2.0f * q);
+  a0_inv = 1.0f / (1.0f + alpha);
+
+  if (type == I3G4250D_BIQUAD_HIGH_PASS)
+  {
+    coef->b0 = ((1.0f + cw) * 0.5f) * a0_inv;
+    coef->b1 = -(1.0f + cw) * a0_inv;
+  }
+
+  else
+  {
+    coef->b0 = ((1.0f - cw) * 0.5f) * a0_inv;
+    coef->b1 = (1.0f - cw) * a0_inv;
+  }
+
+  coef->b2 = coef->b0;
+  coef->a1 = (-2.0f * cw) * a0_inv;
+  coef->a2 = (1.0f - alpha) * a0_inv;
+
+  return 0;
+}
+
+/**
+  * @brief  Biquad cascade initialization. The state is cleared.
+  *
+  * @param  flt    Filter instance.(ptr)
+  * @param  coef   Coefficients of each stage, applied in order.(ptr)
+  * @param  stages Number of stages (1 to I3G4250D_BIQUAD_MAX_STAGES)
+  * @retval        0: done; -1: invalid number of stages
+  *
+  */
+int32_t i3g4250d_biquad_init(i3g4250d_biquad_t *flt,
+                             const i3g4250d_biquad_coef_t *coef,
+                             uint8_t stages)
+{
+  if ((stages == 0U) || (stages > I3G4250D_BIQUAD_MAX_STAGES)) { return -1; }
+
+  (void)memset(flt, 0, sizeof(i3g4250d_biquad_t));
+  (void)memcpy(flt->coef, coef, stages * sizeof(i3g4250d_biquad_coef_t));
+  flt->stages = stages;
+
+  return 0;
+}
+
+/**
+  * @brief  Biquad cascade processing (transposed direct form II).
+  *
+  * @param  flt    Filter instance.(ptr)
+  * @param  in     Raw samples, X Y Z interleaved.(ptr)
+  * @param  out    Filtered samples [LSB], X Y Z interleaved.(ptr)
+  * @param  num    Number of samples
+  *
+  */
+void i3g4250d_biquad_process(i3g4250d_biquad_t *flt, const int16_t *in,
+                             float_t *out, uint16_t num)
+{
+  float_t blk[I3G4250D_FLT_BLOCK][I3G4250D_FLT_LANES];
+  float_t z1[I3G4250D_FLT_LANES];
+  float_t z2[I3G4250D_FLT_LANES];
+  const i3g4250d_biquad_coef_t *c;
+  float_t y;
+  uint16_t n;
+  uint16_t m;
+  uint16_t k;
+  uint8_t s;
+  uint8_t a;
+
+  for (n = 0U; n < num; n += m)
+  {
+    m = (uint16_t)(num - n);
+    if (m > I3G4250D_FLT_BLOCK)
+    {
+      m = I3G4250D_FLT_BLOCK;
+    }
+
+    for (k = 0U; k < m; k++)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        blk[k][a] = (float_t)in[(3U * (n + k)) + a];
+      }
+      blk[k][3] = 0.0f;
+    }
+
+    for (s = 0U; s < flt->stages; s++)
+    {
+      c = &flt->coef[s];
+      (void)memcpy(z1, flt->z1[s], sizeof(z1));
+      (void)memcpy(z2, flt->z2[s], sizeof(z2));
+
+      for (k = 0U; k < m; k++)
+      {
+        for (a = 0U; a < I3G4250D_FLT_LANES; a++)
+        {
+          y = (c->b0 * blk[k][a]) + z1[a];
+          z1[a] = (c->b1 * blk[k][a]) - (c->a1 * y) + z2[a];
+          z2[a] = (c->b2 * blk[k][a]) - (c->a2 * y);
+          blk[k][a] = y;
+        }
+      }
+
+      (void)memcpy(flt->z1[s], z1, sizeof(z1));
+      (void)memcpy(flt->z2[s], z2, sizeof(z2));
+    }
+
+    for (k = 0U; k < m; k++)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        out[(3U * (n + k)) + a] = blk[k][a];
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Moving average initialization. The history is cleared.
+  *
+  * @param  flt    Filter instance.(ptr)
+  * @param  len    Window length (1 to I3G4250D_MAVG_MAX_LEN)
+  * @retval        0: done; -1: invalid window length
+  *
+  */
+int32_t i3g4250d_mavg_init(i3g4250d_mavg_t *flt, uint8_t len)
+{
+  if ((len == 0U) || (len > I3G4250D_MAVG_MAX_LEN)) { return -1; }
+
+  (void)memset(flt, 0, sizeof(i3g4250d_mavg_t));
+  flt->len = len;
+
+  return 0;
+}
+
+/**
+  * @brief  Moving average processing. Sums are kept on integers, so the
+  *         output doesn't drift; until the window is filled the average
+  *         is computed on the samples received so far.
+  *
+  * @param  flt    Filter instance.(ptr)
+  * @param  in     Raw samples, X Y Z interleaved.(ptr)
+  * @param  out    Averaged samples [LSB], X Y Z interleaved.(ptr)
+  * @param  num    Number of samples
+  *
+  */
+void i3g4250d_mavg_process(i3g4250d_mavg_t *flt, const int16_t *in,
+                           float_t *out, uint16_t num)
+{
+  int16_t blk[I3G4250D_FLT_BLOCK][I3G4250D_FLT_LANES];
+  float_t avg[I3G4250D_FLT_BLOCK][I3G4250D_FLT_LANES];
+  int32_t sum[I3G4250D_FLT_LANES];
+  int16_t *hist;
+  float_t scale;
+  uint16_t n;
+  uint16_t m;
+  uint16_t k;
+  uint8_t a;
+
+  (void)memcpy(sum, flt->sum, sizeof(sum));
+
+  for (n = 0U; n < num; n += m)
+  {
+    m = (uint16_t)(num - n);
+    if (m > I3G4250D_FLT_BLOCK)
+    {
+      m = I3G4250D_FLT_BLOCK;
+    }
+
+    for (k = 0U; k < m; k++)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        blk[k][a] = in[(3U * (n + k)) + a];
+      }
+      blk[k][3] = 0;
+    }
+
+    for (k = 0U; k < m; k++)
+    {
+      if (flt->count < flt->len)
+      {
+        flt->count++;
+      }
+
+      scale = 1.0f / (float_t)flt->count;
+      hist = flt->hist[flt->idx];
+
+      for (a = 0U; a < I3G4250D_FLT_LANES; a++)
+      {
+        sum[a] += (int32_t)blk[k][a] - hist[a];
+        hist[a] = blk[k][a];
+        avg[k][a] = (float_t)sum[a] * scale;
+      }
+
+      flt->idx++;
+      if (flt->idx == flt->len)
+      {
+        flt->idx = 0U;
+      }
+    }
+
+    for (k = 0U; k < m; k++)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        out[(3U * (n + k)) + a] = avg[k][a];
+      }
+    }
+  }
+
+  (void)memcpy(flt->sum, sum, sizeof(sum));
+}
+
+/**
+  * @brief  CIC decimator initialization (differential delay 1).
+  *         Integrators wrap around on 32 bits, so R^N must not exceed
+  *         2^16 for the 16-bit input.
+  *
+  * @param  flt    Filter instance.(ptr)
+  * @param  order  Number of integrator / comb stages N
+  *                (1 to I3G4250D_CIC_MAX_ORDER)
+  * @param  rate   Decimation ratio R (>= 2)
+  * @retval        0: done; -1: invalid order or rate
+  *
+  */
+int32_t i3g4250d_cic_init(i3g4250d_cic_t *flt, uint8_t order, uint16_t rate)
+{
+  uint32_t gain = 1U;
+  uint8_t s;
+
+  if ((order == 0U) || (order > I3G4250D_CIC_MAX_ORDER) || (rate < 2U))
+  {
+    return -1;
+  }
+
+  for (s = 0U; s < order; s++)
+  {
+    gain *= rate;
+    if (gain > 65536U) { return -1; }
+  }
+
+  (void)memset(flt, 0, sizeof(i3g4250d_cic_t));
+  flt->order = order;
+  flt->rate = rate;
+  flt->gain_inv = 1.0f / (float_t)gain;
+
+  return 0;
+}
+
+/**
+  * @brief  CIC decimator processing. One output sample is produced
+  *         every "rate" input samples, normalized by the CIC gain.
+  *
+  * @param  flt    Filter instance.(ptr)
+  * @param  in     Raw samples, X Y Z interleaved.(ptr)
+  * @param  num    Number of input samples
+  * @param  out    Decimated samples [LSB], X Y Z interleaved; room for
+  *                (num / rate + 1) samples is needed.(ptr)
+  * @retval        Number of output samples
+  *
+  */
+uint16_t i3g4250d_cic_process(i3g4250d_cic_t *flt, const int16_t *in,
+                              uint16_t num, float_t *out)
+{
+  uint32_t blk[I3G4250D_FLT_BLOCK][I3G4250D_FLT_LANES];
+  uint32_t acc[I3G4250D_FLT_LANES];
+  uint32_t tmp;
+  uint16_t n;
+  uint16_t m;
+  uint16_t k;
+  uint16_t produced = 0U;
+  uint8_t s;
+  uint8_t a;
+
+  for (n = 0U; n < num; n += m)
+  {
+    m = (uint16_t)(num - n);
+    if (m > I3G4250D_FLT_BLOCK)
+    {
+      m = I3G4250D_FLT_BLOCK;
+    }
+
+    for (k = 0U; k < m; k++)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        blk[k][a] = (uint32_t)(int32_t)in[(3U * (n + k)) + a];
+      }
+      blk[k][3] = 0U;
+    }
+
+    for (s = 0U; s < flt->order; s++)
+    {
+      (void)memcpy(acc, flt->integ[s], sizeof(acc));
+
+      for (k = 0U; k < m; k++)
+      {
+        for (a = 0U; a < I3G4250D_FLT_LANES; a++)
+        {
+          acc[a] += blk[k][a];
+          blk[k][a] = acc[a];
+        }
+      }
+
+      (void)memcpy(flt->integ[s], acc, sizeof(acc));
+    }
+
+    for (k = 0U; k < m; k++)
+    {
+      flt->phase++;
+      if (flt->phase == flt->rate)
+      {
+        flt->phase = 0U;
+
+        for (s = 0U; s < flt->order; s++)
+        {
+          for (a = 0U; a < I3G4250D_FLT_LANES; a++)
+          {
+            tmp = blk[k][a];
+            blk[k][a] -= flt->comb[s][a];
+            flt->comb[s][a] = tmp;
+          }
+        }
+
+        for (a = 0U; a < 3U; a++)
+        {
+          out[(3U * produced) + a] = (float_t)(int32_t)blk[k][a] *
+                                     flt->gain_inv;
+        }
+
+        produced++;
+      }
+    }
+  }
+
+  return produced;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
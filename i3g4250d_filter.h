@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_filter.h
+  * @author  Sensors Software Solution Team
+  * @brief   Optional post-filters of the i3g4250d driver: biquad, moving
+  *          average and CIC decimator.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_FILTER_H
+#define I3G4250D_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "i3g4250d_reg.h"
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+typedef enum
+{
+  I3G4250D_BIQUAD_LOW_PASS   = 0,
+  I3G4250D_BIQUAD_HIGH_PASS  = 1,
+} i3g4250d_biquad_type_t;
+
+typedef struct
+{
+  float_t b0;
+  float_t b1;
+  float_t b2;
+  float_t a1;
+  float_t a2;
+} i3g4250d_biquad_coef_t;
+
+/* X, Y, Z and a padding lane: per-axis state fills a 128-bit vector */
+#define I3G4250D_FLT_LANES               4U
+
+#define I3G4250D_BIQUAD_MAX_STAGES       4U
+typedef struct
+{
+  i3g4250d_biquad_coef_t coef[I3G4250D_BIQUAD_MAX_STAGES];
+  float_t z1[I3G4250D_BIQUAD_MAX_STAGES][I3G4250D_FLT_LANES];
+  float_t z2[I3G4250D_BIQUAD_MAX_STAGES][I3G4250D_FLT_LANES];
+  uint8_t stages;
+} i3g4250d_biquad_t;
+int32_t i3g4250d_biquad_coef_get(i3g4250d_biquad_type_t type, float_t fc,
+                                 float_t odr, float_t q,
+                                 i3g4250d_biquad_coef_t *coef);
+int32_t i3g4250d_biquad_init(i3g4250d_biquad_t *flt,
+                             const i3g4250d_biquad_coef_t *coef,
+                             uint8_t stages);
+void i3g4250d_biquad_process(i3g4250d_biquad_t *flt, const int16_t *in,
+                             float_t *out, uint16_t num);
+
+#define I3G4250D_MAVG_MAX_LEN            32U
+typedef struct
+{
+  int16_t hist[I3G4250D_MAVG_MAX_LEN][I3G4250D_FLT_LANES];
+  int32_t sum[I3G4250D_FLT_LANES];
+  uint8_t len;
+  uint8_t idx;
+  uint8_t count;
+} i3g4250d_mavg_t;
+int32_t i3g4250d_mavg_init(i3g4250d_mavg_t *flt, uint8_t len);
+void i3g4250d_mavg_process(i3g4250d_mavg_t *flt, const int16_t *in,
+                           float_t *out, uint16_t num);
+
+#define I3G4250D_CIC_MAX_ORDER           4U
+typedef struct
+{
+  uint32_t integ[I3G4250D_CIC_MAX_ORDER][I3G4250D_FLT_LANES];
+  uint32_t comb[I3G4250D_CIC_MAX_ORDER][I3G4250D_FLT_LANES];
+  float_t gain_inv;
+  uint16_t rate;
+  uint16_t phase;
+  uint8_t order;
+} i3g4250d_cic_t;
+int32_t i3g4250d_cic_init(i3g4250d_cic_t *flt, uint8_t order, uint16_t rate);
+uint16_t i3g4250d_cic_process(i3g4250d_cic_t *flt, const int16_t *in,
+                              uint16_t num, float_t *out);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_FILTER_H */
@@ -0,0 +1,300 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_fusion.c
+  * @author  Sensors Software Solution Team
+  * @brief   Optional attitude estimation of the i3g4250d driver: gyroscope
+  *          integration with accelerometer tilt correction.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_fusion.h"
+#include <string.h>
+
+#define I3G4250D_PI                      3.14159265f
+
+/**
+  * @addtogroup  I3G4250D
+  * @{
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_fusion
+  * @brief      This section groups the attitude fusion of the gyroscope
+  *             with an external accelerometer running on its own clock
+  *             (Mahony complementary filter). Accelerometer samples are
+  *             queued with their timestamps; each gyroscope sample of a
+  *             drained block, timestamped from the block start and the
+  *             sample period, is corrected with the accelerometer
+  *             vector linearly interpolated at the same time. When no
+  *             accelerometer data covers a gyroscope sample, the
+  *             attitude is propagated with the gyroscope only.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Attitude fusion initialization, attitude set to identity.
+  *
+  * @param  fu     Fusion instance.(ptr)
+  * @param  cfg    Filter gains and accelerometer hold time.(ptr)
+  * @param  sens   Gyroscope sensitivity [mdps/LSB]
+  *
+  */
+void i3g4250d_fusion_init(i3g4250d_fusion_t *fu,
+                          const i3g4250d_fusion_cfg_t *cfg, float_t sens)
+{
+  (void)memset(fu, 0, sizeof(i3g4250d_fusion_t));
+  fu->cfg = *cfg;
+  fu->q[0] = 1.0f;
+  fu->sens = (sens / 1000.0f) * (I3G4250D_PI / 180.0f);
+}
+
+/**
+  * @brief  Queue an accelerometer sample. When the queue is full
+  *         (gyroscope data not processed for a while) the oldest sample
+  *         is overwritten, so that the newest attitude reference is
+  *         always kept.
+  *
+  * @param  fu     Fusion instance.(ptr)
+  * @param  acc    Acceleration X, Y, Z in the gyroscope frame, any
+  *                unit.(ptr)
+  * @param  ts_us  Timestamp on the gyroscope time base [us]
+  * @retval        0: done; -1: timestamp not increasing
+  *
+  */
+int32_t i3g4250d_fusion_acc_push(i3g4250d_fusion_t *fu, const float_t *acc,
+                                 uint64_t ts_us)
+{
+  uint8_t idx;
+
+  if (fu->acc_num > 0U)
+  {
+    idx = (uint8_t)((fu->acc_head + fu->acc_num - 1U) %
+                    I3G4250D_FUSION_ACC_DEPTH);
+    if (ts_us <= fu->acc_ts[idx]) { return -1; }
+  }
+
+  if (fu->acc_num >= I3G4250D_FUSION_ACC_DEPTH)
+  {
+    fu->acc_head = (uint8_t)((fu->acc_head + 1U) % I3G4250D_FUSION_ACC_DEPTH);
+    fu->acc_num--;
+  }
+
+  idx = (uint8_t)((fu->acc_head + fu->acc_num) % I3G4250D_FUSION_ACC_DEPTH);
+  (void)memcpy(fu->acc[idx], acc, 3U * sizeof(float_t));
+  fu->acc_ts[idx] = ts_us;
+  fu->acc_num++;
+
+  return 0;
+}
+
+/**
+  * @brief  Accelerometer vector at a gyroscope sample time. Samples
+  *         older than the interpolation pair are dropped.
+  *
+  * @param  fu     Fusion instance.(ptr)
+  * @param  ts_us  Gyroscope sample time [us]
+  * @param  acc    Interpolated acceleration.(ptr)
+  * @retval        1: acc is valid; 0: no accelerometer data at ts_us
+  *
+  */
+static uint8_t i3g4250d_fusion_acc_at(i3g4250d_fusion_t *fu, uint64_t ts_us,
+                                      float_t *acc)
+{
+  uint8_t i0;
+  uint8_t i1;
+  uint8_t a;
+  float_t w;
+
+  while (fu->acc_num >= 2U)
+  {
+    i1 = (uint8_t)((fu->acc_head + 1U) % I3G4250D_FUSION_ACC_DEPTH);
+    if (fu->acc_ts[i1] > ts_us) { break; }
+
+    fu->acc_head = i1;
+    fu->acc_num--;
+  }
+
+  if (fu->acc_num == 0U) { return 0U; }
+
+  i0 = fu->acc_head;
+
+  if (ts_us < fu->acc_ts[i0]) { return 0U; }
+
+  if (fu->acc_num == 1U)
+  {
+    /* newest sample, held for a while */
+    if ((ts_us - fu->acc_ts[i0]) > fu->cfg.hold_us) { return 0U; }
+
+    (void)memcpy(acc, fu->acc[i0], 3U * sizeof(float_t));
+
+    return 1U;
+  }
+
+  i1 = (uint8_t)((i0 + 1U) % I3G4250D_FUSION_ACC_DEPTH);
+  w = (float_t)(ts_us - fu->acc_ts[i0]) /
+      (float_t)(fu->acc_ts[i1] - fu->acc_ts[i0]);
+
+  for (a = 0U; a < 3U; a++)
+  {
+    acc[a] = fu->acc[i0][a] + (w * (fu->acc[i1][a] - fu->acc[i0][a]));
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Attitude update with a block of gyroscope samples.
+  *
+  * @param  fu         Fusion instance.(ptr)
+  * @param  val        Raw samples, X Y Z interleaved.(ptr)
+  * @param  num        Number of samples
+  * @param  ts_us      Timestamp of the first sample [us]
+  * @param  period_us  Sample period [us]
+  *
+  */
+void i3g4250d_fusion_update(i3g4250d_fusion_t *fu, const int16_t *val,
+                            uint16_t num, uint64_t ts_us, uint32_t period_us)
+{
+  float_t *q = fu->q;
+  float_t g[3];
+  float_t acc[3];
+  float_t v[3];
+  float_t e[3];
+  float_t dq[4];
+  float_t norm;
+  float_t hdt;
+  float_t dt;
+  uint64_t t;
+  uint16_t n;
+  uint8_t a;
+
+  dt = (float_t)period_us * 1.0e-6f;
+  hdt = 0.5f * dt;
+
+  for (n = 0U; n < num; n++)
+  {
+    t = ts_us + ((uint64_t)n * period_us);
+
+    for (a = 0U; a < 3U; a++)
+    {
+      g[a] = (float_t)val[(3U * n) + a] * fu->sens;
+    }
+
+    if (i3g4250d_fusion_acc_at(fu, t, acc) != 0U)
+    {
+      norm = sqrtf((acc[0] * acc[0]) + (acc[1] * acc[1]) +
+                   (acc[2] * acc[2]));
+
+      if (norm > 0.0f)
+      {
+        norm = 1.0f / norm;
+
+        for (a = 0U; a < 3U; a++)
+        {
+          acc[a] *= norm;
+        }
+
+        /* gravity direction predicted by the attitude */
+        v[0] = 2.0f * ((q[1] * q[3]) - (q[0] * q[2]));
+        v[1] = 2.0f * ((q[0] * q[1]) + (q[2] * q[3]));
+        v[2] = (q[0] * q[0]) - (q[1] * q[1]) - (q[2] * q[2]) + (q[3] * q[3]);
+
+        e[0] = (acc[1] * v[2]) - (acc[2] * v[1]);
+        e[1] = (acc[2] * v[0]) - (acc[0] * v[2]);
+        e[2] = (acc[0] * v[1]) - (acc[1] * v[0]);
+
+        for (a = 0U; a < 3U; a++)
+        {
+          fu->bias[a] += fu->cfg.ki * e[a] * dt;
+          g[a] += (fu->cfg.kp * e[a]) + fu->bias[a];
+        }
+      }
+    }
+
+    else
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        g[a] += fu->bias[a];
+      }
+    }
+
+    dq[0] = -(q[1] * g[0]) - (q[2] * g[1]) - (q[3] * g[2]);
+    dq[1] = (q[0] * g[0]) + (q[2] * g[2]) - (q[3] * g[1]);
+    dq[2] = (q[0] * g[1]) - (q[1] * g[2]) + (q[3] * g[0]);
+    dq[3] = (q[0] * g[2]) + (q[1] * g[1]) - (q[2] * g[0]);
+
+    for (a = 0U; a < 4U; a++)
+    {
+      q[a] += hdt * dq[a];
+    }
+
+    norm = 1.0f / sqrtf((q[0] * q[0]) + (q[1] * q[1]) +
+                        (q[2] * q[2]) + (q[3] * q[3]));
+
+    for (a = 0U; a < 4U; a++)
+    {
+      q[a] *= norm;
+    }
+  }
+}
+
+/**
+  * @brief  Attitude quaternion.[get]
+  *
+  * @param  fu     Fusion instance.(ptr)
+  * @param  q      Quaternion W, X, Y, Z (sensor to reference frame).(ptr)
+  *
+  */
+void i3g4250d_fusion_quat_get(const i3g4250d_fusion_t *fu, float_t *q)
+{
+  (void)memcpy(q, fu->q, 4U * sizeof(float_t));
+}
+
+/**
+  * @brief  Attitude as Euler angles.[get]
+  *
+  * @param  fu     Fusion instance.(ptr)
+  * @param  val    Roll, pitch, yaw [deg].(ptr)
+  *
+  */
+void i3g4250d_fusion_euler_get(const i3g4250d_fusion_t *fu, float_t *val)
+{
+  const float_t *q = fu->q;
+  float_t sinp;
+
+  sinp = 2.0f * ((q[0] * q[2]) - (q[3] * q[1]));
+  sinp = (sinp > 1.0f) ? 1.0f : ((sinp < -1.0f) ? -1.0f : sinp);
+
+  val[0] = atan2f(2.0f * ((q[0] * q[1]) + (q[2] * q[3])),
+                  1.0f - (2.0f * ((q[1] * q[1]) + (q[2] * q[2]))));
+  val[1] = asinf(sinp);
+  val[2] = atan2f(2.0f * ((q[0] * q[3]) + (q[1] * q[2])),
+                  1.0f - (2.0f * ((q[2] * q[2]) + (q[3] * q[3]))));
+
+  val[0] *= 180.0f / I3G4250D_PI;
+  val[1] *= 180.0f / I3G4250D_PI;
+  val[2] *= 180.0f / I3G4250D_PI;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_fusion.h
+  * @author  Sensors Software Solution Team
+  * @brief   Optional attitude estimation of the i3g4250d driver: gyroscope
+  *          integration with accelerometer tilt correction.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_FUSION_H
+#define I3G4250D_FUSION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "i3g4250d_reg.h"
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+#ifndef I3G4250D_FUSION_ACC_DEPTH
+#define I3G4250D_FUSION_ACC_DEPTH        16U
+#endif /* I3G4250D_FUSION_ACC_DEPTH */
+typedef struct
+{
+  float_t kp;                 /* proportional gain [1/s] */
+  float_t ki;                 /* integral gain [1/s^2], 0: no bias */
+  uint32_t hold_us;           /* newest accel sample use limit */
+} i3g4250d_fusion_cfg_t;
+
+typedef struct
+{
+  i3g4250d_fusion_cfg_t cfg;
+  float_t q[4];               /* attitude quaternion W X Y Z */
+  float_t bias[3];            /* integral correction [rad/s] */
+  float_t sens;               /* [rad/s / LSB] */
+  float_t acc[I3G4250D_FUSION_ACC_DEPTH][3];
+  uint64_t acc_ts[I3G4250D_FUSION_ACC_DEPTH];
+  uint8_t acc_head;
+  uint8_t acc_num;
+} i3g4250d_fusion_t;
+void i3g4250d_fusion_init(i3g4250d_fusion_t *fu,
+                          const i3g4250d_fusion_cfg_t *cfg, float_t sens);
+int32_t i3g4250d_fusion_acc_push(i3g4250d_fusion_t *fu, const float_t *acc,
+                                 uint64_t ts_us);
+void i3g4250d_fusion_update(i3g4250d_fusion_t *fu, const int16_t *val,
+                            uint16_t num, uint64_t ts_us, uint32_t period_us);
+void i3g4250d_fusion_quat_get(const i3g4250d_fusion_t *fu, float_t *q);
+void i3g4250d_fusion_euler_get(const i3g4250d_fusion_t *fu, float_t *val);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_FUSION_H */
@@ -0,0 +1,403 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_linux.c
+  * @author  Sensors Software Solution Team
+  * @brief   Optional Linux user space integration of the i3g4250d
+  *          driver: bus functions on /dev/i2c-N and /dev/spidevX.Y, and
+  *          FIFO watermark delivery through epoll.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_linux.h"
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+
+/** Read bit of the SPI sub-address **/
+#define I3G4250D_SPI_READ                0x80U
+
+/**
+  * @addtogroup  I3G4250D
+  * @{
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_linux
+  * @brief      This section groups the platform read and write functions
+  *             for Linux user space, "handle" being an
+  *             i3g4250d_linux_bus_t. Each register burst is a single
+  *             system call: one I2C_RDWR ioctl with a repeated start
+  *             between the sub-address and the data, or one
+  *             SPI_IOC_MESSAGE keeping the chip select asserted.
+  *             The multi-byte auto-increment bit is set by the driver:
+  *             declare the bus with i3g4250d_bus_mode_set().
+  *             The batch reads bypass the driver and set it themselves;
+  *             the bytes are returned in the device byte order.
+  * @{
+  *
+  */
+
+/**
+  * @brief  ioctl() of the C library, with a fixed prototype for
+  *         i3g4250d_linux_bus_t.
+  *
+  * @param  fd     Bus device file descriptor
+  * @param  req    Request code
+  * @param  arg    Request argument.(ptr)
+  * @retval        ioctl() result (< 0: error)
+  *
+  */
+int i3g4250d_linux_ioctl(int fd, unsigned long req, void *arg)
+{
+  return ioctl(fd, req, arg);
+}
+
+/**
+  * @brief  Bus initialization, on ioctl().
+  *
+  * @param  bus    Bus instance.(ptr)
+  * @param  fd     /dev/i2c-N or /dev/spidevX.Y file descriptor
+  * @param  addr   7-bit I2C address (unused on SPI)
+  *
+  */
+void i3g4250d_linux_bus_init(i3g4250d_linux_bus_t *bus, int fd,
+                             uint16_t addr)
+{
+  bus->ioctl = i3g4250d_linux_ioctl;
+  bus->fd = fd;
+  bus->addr = addr;
+}
+
+/**
+  * @brief  I2C read: sub-address write, repeated start and data read,
+  *         in a single I2C_RDWR.
+  *
+  * @param  handle Bus instance (i3g4250d_linux_bus_t).(ptr)
+  * @param  reg    Sub-address
+  * @param  buf    Data read.(ptr)
+  * @param  len    Number of bytes
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_linux_i2c_read(void *handle, uint8_t reg, uint8_t *buf,
+                                uint16_t len)
+{
+  const i3g4250d_linux_bus_t *bus = (const i3g4250d_linux_bus_t *)handle;
+  struct i2c_msg msg[2];
+  struct i2c_rdwr_ioctl_data xfer;
+
+  msg[0].addr = bus->addr;
+  msg[0].flags = 0U;
+  msg[0].len = 1U;
+  msg[0].buf = &reg;
+  msg[1].addr = bus->addr;
+  msg[1].flags = I2C_M_RD;
+  msg[1].len = len;
+  msg[1].buf = buf;
+  xfer.msgs = msg;
+  xfer.nmsgs = 2U;
+
+  return (bus->ioctl(bus->fd, I2C_RDWR, &xfer) < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  I2C write: sub-address and data in a single message.
+  *
+  * @param  handle Bus instance (i3g4250d_linux_bus_t).(ptr)
+  * @param  reg    Sub-address
+  * @param  buf    Data to write.(ptr)
+  * @param  len    Number of bytes (up to I3G4250D_LINUX_WRITE_MAX)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_linux_i2c_write(void *handle, uint8_t reg,
+                                 const uint8_t *buf, uint16_t len)
+{
+  const i3g4250d_linux_bus_t *bus = (const i3g4250d_linux_bus_t *)handle;
+  uint8_t data[1U + I3G4250D_LINUX_WRITE_MAX];
+  struct i2c_msg msg;
+  struct i2c_rdwr_ioctl_data xfer;
+
+  if (len > I3G4250D_LINUX_WRITE_MAX) { return -1; }
+
+  data[0] = reg;
+  (void)memcpy(&data[1], buf, len);
+  msg.addr = bus->addr;
+  msg.flags = 0U;
+  msg.len = (uint16_t)(len + 1U);
+  msg.buf = data;
+  xfer.msgs = &msg;
+  xfer.nmsgs = 1U;
+
+  return (bus->ioctl(bus->fd, I2C_RDWR, &xfer) < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  SPI read: sub-address with the read bit, then the data, in a
+  *         single SPI_IOC_MESSAGE.
+  *
+  * @param  handle Bus instance (i3g4250d_linux_bus_t).(ptr)
+  * @param  reg    Sub-address
+  * @param  buf    Data read.(ptr)
+  * @param  len    Number of bytes
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_linux_spi_read(void *handle, uint8_t reg, uint8_t *buf,
+                                uint16_t len)
+{
+  const i3g4250d_linux_bus_t *bus = (const i3g4250d_linux_bus_t *)handle;
+  struct spi_ioc_transfer xfer[2];
+  uint8_t sub = (uint8_t)(reg | I3G4250D_SPI_READ);
+
+  (void)memset(xfer, 0, sizeof(xfer));
+  xfer[0].tx_buf = (uintptr_t)&sub;
+  xfer[0].len = 1U;
+  xfer[1].rx_buf = (uintptr_t)buf;
+  xfer[1].len = len;
+
+  return (bus->ioctl(bus->fd, SPI_IOC_MESSAGE(2), xfer) < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  SPI write: sub-address, then the data, in a single
+  *         SPI_IOC_MESSAGE.
+  *
+  * @param  handle Bus instance (i3g4250d_linux_bus_t).(ptr)
+  * @param  reg    Sub-address
+  * @param  buf    Data to write.(ptr)
+  * @param  len    Number of bytes
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_linux_spi_write(void *handle, uint8_t reg,
+                                 const uint8_t *buf, uint16_t len)
+{
+  const i3g4250d_linux_bus_t *bus = (const i3g4250d_linux_bus_t *)handle;
+  struct spi_ioc_transfer xfer[2];
+
+  (void)memset(xfer, 0, sizeof(xfer));
+  xfer[0].tx_buf = (uintptr_t)&reg;
+  xfer[0].len = 1U;
+  xfer[1].tx_buf = (uintptr_t)buf;
+  xfer[1].len = len;
+
+  return (bus->ioctl(bus->fd, SPI_IOC_MESSAGE(2), xfer) < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  Register bursts of several devices sharing an I2C bus (e.g.
+  *         the samples of each one, on the same watermark period), in a
+  *         single I2C_RDWR. The ioctl and file descriptor of the first
+  *         device are used.
+  *
+  * @param  rd     Bursts, with the address of each device.(ptr)
+  * @param  num    Number of bursts (1 to I3G4250D_LINUX_BATCH_MAX)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_linux_i2c_read_batch(const i3g4250d_linux_read_t *rd,
+                                      uint8_t num)
+{
+  struct i2c_msg msg[2U * I3G4250D_LINUX_BATCH_MAX];
+  uint8_t sub[I3G4250D_LINUX_BATCH_MAX];
+  struct i2c_rdwr_ioctl_data xfer;
+  uint8_t i;
+
+  if ((num == 0U) || (num > I3G4250D_LINUX_BATCH_MAX)) { return -1; }
+
+  for (i = 0U; i < num; i++)
+  {
+    sub[i] = (rd[i].len > 1U) ?
+             (uint8_t)(rd[i].reg | I3G4250D_I2C_AUTO_INCREMENT) : rd[i].reg;
+    msg[2U * i].addr = rd[i].bus->addr;
+    msg[2U * i].flags = 0U;
+    msg[2U * i].len = 1U;
+    msg[2U * i].buf = &sub[i];
+    msg[(2U * i) + 1U].addr = rd[i].bus->addr;
+    msg[(2U * i) + 1U].flags = I2C_M_RD;
+    msg[(2U * i) + 1U].len = rd[i].len;
+    msg[(2U * i) + 1U].buf = rd[i].buf;
+  }
+  xfer.msgs = msg;
+  xfer.nmsgs = 2U * (uint32_t)num;
+
+  return (rd[0].bus->ioctl(rd[0].bus->fd, I2C_RDWR, &xfer) < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  Register bursts of one SPI device (e.g. STATUS_REG and the
+  *         output registers), in a single SPI_IOC_MESSAGE: the chip
+  *         select is released between the bursts. The ioctl and file
+  *         descriptor of the first burst are used.
+  *
+  * @param  rd     Bursts.(ptr)
+  * @param  num    Number of bursts (1 to I3G4250D_LINUX_BATCH_MAX)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_linux_spi_read_batch(const i3g4250d_linux_read_t *rd,
+                                      uint8_t num)
+{
+  struct spi_ioc_transfer xfer[2U * I3G4250D_LINUX_BATCH_MAX];
+  uint8_t sub[I3G4250D_LINUX_BATCH_MAX];
+  uint8_t i;
+
+  if ((num == 0U) || (num > I3G4250D_LINUX_BATCH_MAX)) { return -1; }
+
+  (void)memset(xfer, 0, sizeof(xfer));
+  for (i = 0U; i < num; i++)
+  {
+    sub[i] = (uint8_t)(rd[i].reg | I3G4250D_SPI_READ);
+    if (rd[i].len > 1U)
+    {
+      sub[i] |= (uint8_t)I3G4250D_SPI_AUTO_INCREMENT;
+    }
+    xfer[2U * i].tx_buf = (uintptr_t)&sub[i];
+    xfer[2U * i].len = 1U;
+    xfer[(2U * i) + 1U].rx_buf = (uintptr_t)rd[i].buf;
+    xfer[(2U * i) + 1U].len = rd[i].len;
+    xfer[(2U * i) + 1U].cs_change = ((i + 1U) < num) ? 1U : 0U;
+  }
+
+  return (rd[0].bus->ioctl(rd[0].bus->fd, SPI_IOC_MESSAGE(2U * num),
+                           xfer) < 0) ? -1 : 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_linux_event
+  * @brief      This section groups the FIFO watermark delivery on Linux:
+  *             the INT2 watermark line, requested as a GPIO line event
+  *             (/dev/gpiochipN, GPIO_V2_LINE_FLAG_EDGE_RISING), or an
+  *             eventfd in tests, is waited for with epoll instead of
+  *             polling from a sleep loop. Each device is registered
+  *             once with itself as epoll_data.ptr and owns its sample
+  *             buffer: any number of devices share one epoll set, and
+  *             nothing is allocated per event.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Register a device in an epoll set.
+  *
+  * @param  epfd   epoll file descriptor
+  * @param  dev    Device, with its context, consumer and watermark
+  *                file descriptor set; kept until removed.(ptr)
+  * @retval        0: done; -1: epoll_ctl error
+  *
+  */
+int32_t i3g4250d_linux_event_add(int epfd, i3g4250d_linux_dev_t *dev)
+{
+  struct epoll_event ev;
+
+  (void)memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN;
+  ev.data.ptr = dev;
+  dev->errors = 0U;
+
+  return (epoll_ctl(epfd, EPOLL_CTL_ADD, dev->fd, &ev) < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  Remove a device from an epoll set.
+  *
+  * @param  epfd   epoll file descriptor
+  * @param  dev    Device.(ptr)
+  * @retval        0: done; -1: epoll_ctl error
+  *
+  */
+int32_t i3g4250d_linux_event_del(int epfd, i3g4250d_linux_dev_t *dev)
+{
+  struct epoll_event ev;
+
+  (void)memset(&ev, 0, sizeof(ev));
+
+  return (epoll_ctl(epfd, EPOLL_CTL_DEL, dev->fd, &ev) < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  Wait for watermark events and drain the FIFO of each ready
+  *         device into its buffer, handed to its consumer. The events
+  *         are acknowledged first, so a watermark reached during the
+  *         drain is not lost; the FIFO is read a second time when the
+  *         first drain fills the whole buffer (overrun).
+  *
+  * @param  epfd       epoll file descriptor
+  * @param  timeout_ms Longest wait [ms], -1: no timeout
+  * @retval            Number of devices handled (0 on timeout or signal);
+  *                    -1: epoll_wait error
+  *
+  */
+int32_t i3g4250d_linux_event_dispatch(int epfd, int timeout_ms)
+{
+  struct epoll_event ev[I3G4250D_LINUX_EVENTS_MAX];
+  struct gpio_v2_line_event le[8];    /* also fits the eventfd counter */
+  i3g4250d_linux_dev_t *dev;
+  uint8_t round;
+  uint8_t num;
+  int n;
+  int i;
+
+  n = epoll_wait(epfd, ev, (int)I3G4250D_LINUX_EVENTS_MAX, timeout_ms);
+  if (n < 0)
+  {
+    return (errno == EINTR) ? 0 : -1;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    dev = (i3g4250d_linux_dev_t *)ev[i].data.ptr;
+    (void)read(dev->fd, le, sizeof(le));
+
+    num = (uint8_t)I3G4250D_FIFO_DEPTH;
+    for (round = 0U; (round < 2U) && (num == I3G4250D_FIFO_DEPTH); round++)
+    {
+      if (i3g4250d_fifo_drain(dev->ctx, dev->val,
+                              (uint8_t)I3G4250D_FIFO_DEPTH, &num) != 0)
+      {
+        dev->errors++;
+        break;
+      }
+
+      if (num > 0U)
+      {
+        dev->consume(dev->user, dev->val, num);
+      }
+    }
+  }
+
+  return (int32_t)n;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
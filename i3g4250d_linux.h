@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_linux.h
+  * @author  Sensors Software Solution Team
+  * @brief   Optional Linux user space integration of the i3g4250d
+  *          driver: bus functions on /dev/i2c-N and /dev/spidevX.Y, and
+  *          FIFO watermark delivery through epoll.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_LINUX_H
+#define I3G4250D_LINUX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "i3g4250d_reg.h"
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+/** ioctl() of the bus device, or a test shim **/
+typedef int (*i3g4250d_ioctl_t)(int fd, unsigned long req, void *arg);
+
+typedef struct
+{
+  i3g4250d_ioctl_t ioctl;
+  int fd;                 /* /dev/i2c-N or /dev/spidevX.Y */
+  uint16_t addr;          /* 7-bit I2C address, ie. I3G4250D_I2C_ADD_L >> 1 */
+} i3g4250d_linux_bus_t;
+
+/** Longest register write: sub-address and data in one I2C message **/
+#define I3G4250D_LINUX_WRITE_MAX         16U
+
+/** Register bursts of one batch (two messages each on I2C) **/
+#define I3G4250D_LINUX_BATCH_MAX         16U
+
+typedef struct
+{
+  const i3g4250d_linux_bus_t *bus;  /* I2C: device address; SPI: all on
+                                       the bus of the batch */
+  uint8_t *buf;
+  uint16_t len;
+  uint8_t reg;
+} i3g4250d_linux_read_t;
+
+/** Device waiting for the FIFO watermark on a file descriptor **/
+typedef struct
+{
+  const stmdev_ctx_t *ctx;
+  void (*consume)(void *user, const int16_t *val, uint8_t num);
+  void *user;
+  int fd;                 /* GPIO line request, or eventfd in tests */
+  int16_t val[3U * I3G4250D_FIFO_DEPTH];
+  uint32_t errors;        /* failed drains */
+} i3g4250d_linux_dev_t;
+
+/** Ready devices handled per i3g4250d_linux_event_dispatch() **/
+#define I3G4250D_LINUX_EVENTS_MAX        16U
+
+int i3g4250d_linux_ioctl(int fd, unsigned long req, void *arg);
+void i3g4250d_linux_bus_init(i3g4250d_linux_bus_t *bus, int fd,
+                             uint16_t addr);
+
+int32_t i3g4250d_linux_i2c_read(void *handle, uint8_t reg, uint8_t *buf,
+                                uint16_t len);
+int32_t i3g4250d_linux_i2c_write(void *handle, uint8_t reg,
+                                 const uint8_t *buf, uint16_t len);
+int32_t i3g4250d_linux_spi_read(void *handle, uint8_t reg, uint8_t *buf,
+                                uint16_t len);
+int32_t i3g4250d_linux_spi_write(void *handle, uint8_t reg,
+                                 const uint8_t *buf, uint16_t len);
+
+int32_t i3g4250d_linux_i2c_read_batch(const i3g4250d_linux_read_t *rd,
+                                      uint8_t num);
+int32_t i3g4250d_linux_spi_read_batch(const i3g4250d_linux_read_t *rd,
+                                      uint8_t num);
+
+int32_t i3g4250d_linux_event_add(int epfd, i3g4250d_linux_dev_t *dev);
+int32_t i3g4250d_linux_event_del(int epfd, i3g4250d_linux_dev_t *dev);
+int32_t i3g4250d_linux_event_dispatch(int epfd, int timeout_ms);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_LINUX_H */
@@ -1,2050 +1,5481 @@
-/**
-  ******************************************************************************
-  * @file    i3g4250d_reg.c
-  * @author  Sensors Software Solution Team
-  * @brief   I3G4250D driver file
-  ******************************************************************************
-  * @attention
-  *
-  * Copyright (c) 2021 STMicroelectronics.
-  * All rights reserved.
-  *
-  * This software is licensed under terms that can be found in the LICENSE file
-  * in the root directory of this software component.
-  * If no LICENSE file comes with this software, it is provided AS-IS.
-  *
-  ******************************************************************************
-  */
-
-#include "i3g4250d_reg.h"
-
-/**
-  * @defgroup    I3G4250D
-  * @brief       This file provides a set of functions needed to drive the
-  *              i3g4250d enhanced inertial module.
-  * @{
-  *
-  */
-
-/**
-  * @defgroup    I3G4250D_Interfaces_Functions
-  * @brief       This section provide a set of functions used to read and
-  *              write a generic register of the device.
-  *              MANDATORY: return 0 -> no Error.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Read generic device register
-  *
-  * @param  ctx   read / write interface definitions(ptr)
-  * @param  reg   register to read
-  * @param  data  pointer to buffer that store the data read(ptr)
-  * @param  len   number of consecutive register to read
-  * @retval       interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t __weak i3g4250d_read_reg(const stmdev_ctx_t *ctx, uint8_t reg,
-                                 uint8_t *data,
-                                 uint16_t len)
-{
-  int32_t ret;
-
-  if (ctx == NULL) return -1;
-
-  ret = ctx->read_reg(ctx->handle, reg, data, len);
-
-  return ret;
-}
-
-/**
-  * @brief  Write generic device register
-  *
-  * @param  ctx   read / write interface definitions(ptr)
-  * @param  reg   register to write
-  * @param  data  pointer to data to write in register reg(ptr)
-  * @param  len   number of consecutive register to write
-  * @retval       interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t __weak i3g4250d_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
-                                  uint8_t *data,
-                                  uint16_t len)
-{
-  int32_t ret;
-
-  if (ctx == NULL) return -1;
-
-  ret = ctx->write_reg(ctx->handle, reg, data, len);
-
-  return ret;
-}
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup    I3G4250D_Sensitivity
-  * @brief       These functions convert raw-data into engineering units.
-  * @{
-  *
-  */
-
-float_t i3g4250d_from_fs245dps_to_mdps(int16_t lsb)
-{
-  return ((float_t)lsb * 8.75f);
-}
-
-float_t i3g4250d_from_lsb_to_celsius(int16_t lsb)
-{
-  return ((float_t)lsb + 25.0f);
-}
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   I3G4250D_data_generation
-  * @brief      This section groups all the functions concerning
-  *             data generation
-  * @{
-  *
-  */
-
-/**
-  * @brief  Accelerometer data rate selection.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of dr in reg CTRL_REG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_data_rate_set(const stmdev_ctx_t *ctx, i3g4250d_dr_t val)
-{
-  i3g4250d_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
-                          (uint8_t *)&ctrl_reg1, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg1.dr = ((uint8_t)val & 0x30U) >> 4;
-    ctrl_reg1.pd = ((uint8_t)val & 0x0FU);
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG1,
-                             (uint8_t *)&ctrl_reg1, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Accelerometer data rate selection.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of dr in reg CTRL_REG1.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_data_rate_get(const stmdev_ctx_t *ctx, i3g4250d_dr_t *val)
-{
-  i3g4250d_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
-                          (uint8_t *)&ctrl_reg1, 1);
-  if (ret != 0) { return ret; }
-
-  switch ((ctrl_reg1.dr  << 4) + ctrl_reg1.pd)
-  {
-    case 0x00:
-      *val = I3G4250D_ODR_OFF;
-      break;
-
-    case 0x08:
-      *val = I3G4250D_ODR_SLEEP;
-      break;
-
-    case 0x0F:
-      *val = I3G4250D_ODR_100Hz;
-      break;
-
-    case 0x1F:
-      *val = I3G4250D_ODR_200Hz;
-      break;
-
-    case 0x2F:
-      *val = I3G4250D_ODR_400Hz;
-      break;
-
-    case 0x3F:
-      *val = I3G4250D_ODR_800Hz;
-      break;
-
-    default:
-      *val = I3G4250D_ODR_OFF;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Gyroscope full-scale selection.[set]
-  *
-  * @param  ctx    read / write interface definitions(ptr)
-  * @param  val    change the values of fs in reg CTRL_REG4
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_full_scale_set(const stmdev_ctx_t *ctx, i3g4250d_fs_t val)
-{
-  i3g4250d_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
-                          (uint8_t *)&ctrl_reg4, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg4.fs = (uint8_t)val & 0x03U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
-                             (uint8_t *)&ctrl_reg4, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Gyroscope full-scale selection.[get]
-  *
-  * @param  ctx    read / write interface definitions(ptr)
-  * @param  val    Get the values of fs in reg CTRL_REG4
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_full_scale_get(const stmdev_ctx_t *ctx, i3g4250d_fs_t *val)
-{
-  i3g4250d_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
-                          (uint8_t *)&ctrl_reg4, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg4.fs)
-  {
-    case 0x00:
-      *val = I3G4250D_245dps;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_500dps;
-      break;
-
-    case 0x02:
-      *val = I3G4250D_2000dps;
-      break;
-
-    default:
-      *val = I3G4250D_245dps;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  The STATUS_REG register is read by the primary interface.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    registers STATUS_REG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_status_reg_get(const stmdev_ctx_t *ctx,
-                                i3g4250d_status_reg_t *val)
-{
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_STATUS_REG, (uint8_t *) val, 1);
-
-  return ret;
-}
-
-/**
-  * @brief  Accelerometer new data available.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of "zyxda" in reg STATUS_REG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_flag_data_ready_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  i3g4250d_status_reg_t status_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_STATUS_REG,
-                          (uint8_t *)&status_reg, 1);
-  if (ret != 0) { return ret; }
-
-  *val = status_reg.zyxda;
-
-  return ret;
-}
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   I3G4250D_Dataoutput
-  * @brief      This section groups all the data output functions.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Temperature data.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores the data read.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_temperature_raw_get(const stmdev_ctx_t *ctx, uint8_t *buff)
-{
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_OUT_TEMP, buff, 1);
-
-  return ret;
-}
-
-/**
-  * @brief  Angular rate sensor. The value is expressed as a 16-bit word in
-  *         two's complement.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores the data read.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_angular_rate_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
-{
-  uint8_t buff[6];
-  int32_t ret;
-
-  ret =  i3g4250d_read_reg(ctx, I3G4250D_OUT_X_L, buff, 6);
-  if (ret != 0) { return ret; }
-
-  val[0] = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
-  val[1] = (int16_t)(buff[2] | ((uint16_t)buff[3] << 8));
-  val[2] = (int16_t)(buff[4] | ((uint16_t)buff[5] << 8));
-
-  return ret;
-}
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   I3G4250D_common
-  * @brief      This section groups common useful functions.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Device Who amI.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores the data read.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_device_id_get(const stmdev_ctx_t *ctx, uint8_t *buff)
-{
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_WHO_AM_I, buff, 1);
-
-  return ret;
-}
-
-/**
-  * @brief  Angular rate sensor self-test enable. [set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    change the values of st in reg CTRL_REG4.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_self_test_set(const stmdev_ctx_t *ctx, i3g4250d_st_t val)
-{
-  i3g4250d_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
-                          (uint8_t *)&ctrl_reg4, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg4.st = (uint8_t)val & 0x03U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
-                             (uint8_t *)&ctrl_reg4, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Angular rate sensor self-test enable. [get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of st in reg CTRL_REG4.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_self_test_get(const stmdev_ctx_t *ctx, i3g4250d_st_t *val)
-{
-  i3g4250d_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
-                          (uint8_t *)&ctrl_reg4, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg4.st)
-  {
-    case 0x00:
-      *val = I3G4250D_GY_ST_DISABLE;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_GY_ST_POSITIVE;
-      break;
-
-    case 0x03:
-      *val = I3G4250D_GY_ST_NEGATIVE;
-      break;
-
-    default:
-      *val = I3G4250D_GY_ST_DISABLE;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Big/Little Endian data selection.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of "ble" in reg CTRL_REG4.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_data_format_set(const stmdev_ctx_t *ctx,
-                                 i3g4250d_ble_t val)
-{
-  i3g4250d_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
-                          (uint8_t *)&ctrl_reg4, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg4.ble = (uint8_t)val & 0x01U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
-                             (uint8_t *)&ctrl_reg4, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Big/Little Endian data selection.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of "ble" in reg CTRL_REG4.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_data_format_get(const stmdev_ctx_t *ctx,
-                                 i3g4250d_ble_t *val)
-{
-  i3g4250d_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
-                          (uint8_t *)&ctrl_reg4, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg4.ble)
-  {
-    case 0x00:
-      *val = I3G4250D_AUX_LSB_AT_LOW_ADD;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_AUX_MSB_AT_LOW_ADD;
-      break;
-
-    default:
-      *val = I3G4250D_AUX_LSB_AT_LOW_ADD;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Reboot memory content. Reload the calibration parameters.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of boot in reg CTRL_REG5.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_boot_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  i3g4250d_ctrl_reg5_t ctrl_reg5;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
-                          (uint8_t *)&ctrl_reg5, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg5.boot = val & 0x01U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG5,
-                             (uint8_t *)&ctrl_reg5, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Reboot memory content. Reload the calibration parameters.[get]
-  *
-  * @param  ctx     Read / write interface definitions.(ptr)
-  * @param  val     Get the values of boot in reg CTRL_REG5.(ptr)
-  * @retval         interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_boot_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  i3g4250d_ctrl_reg5_t ctrl_reg5;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
-                          (uint8_t *)&ctrl_reg5, 1);
-  if (ret != 0) { return ret; }
-
-  *val = ctrl_reg5.boot;
-
-  return ret;
-}
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   I3G4250D_filters
-  * @brief      This section group all the functions concerning the
-  *             filters configuration.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Lowpass filter bandwidth selection.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of "bw" in reg CTRL_REG1.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_lp_bandwidth_set(const stmdev_ctx_t *ctx,
-                                  i3g4250d_bw_t val)
-{
-  i3g4250d_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
-                          (uint8_t *)&ctrl_reg1, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg1.bw = (uint8_t)val & 0x03U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG1,
-                             (uint8_t *)&ctrl_reg1, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Lowpass filter bandwidth selection.[get]
-  *
-  * @param  ctx     Read / write interface definitions.(ptr)
-  * @param  val     Get the values of "bw" in reg CTRL_REG1.(ptr)
-  * @retval         Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_lp_bandwidth_get(const stmdev_ctx_t *ctx,
-                                  i3g4250d_bw_t *val)
-{
-  i3g4250d_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
-                          (uint8_t *)&ctrl_reg1, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg1.bw)
-  {
-    case 0x00:
-      *val = I3G4250D_CUT_OFF_LOW;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_CUT_OFF_MEDIUM;
-      break;
-
-    case 0x02:
-      *val = I3G4250D_CUT_OFF_HIGH;
-      break;
-
-    case 0x03:
-      *val = I3G4250D_CUT_OFF_VERY_HIGH;
-      break;
-
-    default:
-      *val = I3G4250D_CUT_OFF_LOW;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  High-pass filter bandwidth selection.[set]
-  *
-  * @param  ctx     Read / write interface definitions.(ptr)
-  * @param  val     Change the values of "hpcf" in reg CTRL_REG2.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_hp_bandwidth_set(const stmdev_ctx_t *ctx,
-                                  i3g4250d_hpcf_t val)
-{
-  i3g4250d_ctrl_reg2_t ctrl_reg2;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG2,
-                          (uint8_t *)&ctrl_reg2, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg2.hpcf = (uint8_t)val & 0x0FU;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG2,
-                             (uint8_t *)&ctrl_reg2, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  High-pass filter bandwidth selection.[get]
-  *
-  * @param  ctx     Read / write interface definitions.(ptr)
-  * @param  val     Get the values of hpcf in reg CTRL_REG2.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_hp_bandwidth_get(const stmdev_ctx_t *ctx,
-                                  i3g4250d_hpcf_t *val)
-{
-  i3g4250d_ctrl_reg2_t ctrl_reg2;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG2,
-                          (uint8_t *)&ctrl_reg2, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg2.hpcf)
-  {
-    case 0x00:
-      *val = I3G4250D_HP_LEVEL_0;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_HP_LEVEL_1;
-      break;
-
-    case 0x02:
-      *val = I3G4250D_HP_LEVEL_2;
-      break;
-
-    case 0x03:
-      *val = I3G4250D_HP_LEVEL_3;
-      break;
-
-    case 0x04:
-      *val = I3G4250D_HP_LEVEL_4;
-      break;
-
-    case 0x05:
-      *val = I3G4250D_HP_LEVEL_5;
-      break;
-
-    case 0x06:
-      *val = I3G4250D_HP_LEVEL_6;
-      break;
-
-    case 0x07:
-      *val = I3G4250D_HP_LEVEL_7;
-      break;
-
-    case 0x08:
-      *val = I3G4250D_HP_LEVEL_8;
-      break;
-
-    case 0x09:
-      *val = I3G4250D_HP_LEVEL_9;
-      break;
-
-    default:
-      *val = I3G4250D_HP_LEVEL_0;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  High-pass filter mode selection. [set]
-  *
-  * @param  ctx     Read / write interface definitions.(ptr)
-  * @param  val     Change the values of "hpm" in reg CTRL_REG2.
-  * @retval         Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_hp_mode_set(const stmdev_ctx_t *ctx, i3g4250d_hpm_t val)
-{
-  i3g4250d_ctrl_reg2_t ctrl_reg2;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG2,
-                          (uint8_t *)&ctrl_reg2, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg2.hpm = (uint8_t)val & 0x03U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG2,
-                             (uint8_t *)&ctrl_reg2, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  High-pass filter mode selection. [get]
-  *
-  * @param  ctx     Read / write interface definitions.(ptr)
-  * @param  val     Get the values of hpm in reg CTRL_REG2.(ptr)
-  * @retval         Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_hp_mode_get(const stmdev_ctx_t *ctx, i3g4250d_hpm_t *val)
-{
-  i3g4250d_ctrl_reg2_t ctrl_reg2;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG2,
-                          (uint8_t *)&ctrl_reg2, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg2.hpm)
-  {
-    case 0x00:
-      *val = I3G4250D_HP_NORMAL_MODE_WITH_RST;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_HP_REFERENCE_SIGNAL;
-      break;
-
-    case 0x02:
-      *val = I3G4250D_HP_NORMAL_MODE;
-      break;
-
-    case 0x03:
-      *val = I3G4250D_HP_AUTO_RESET_ON_INT;
-      break;
-
-    default:
-      *val = I3G4250D_HP_NORMAL_MODE_WITH_RST;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Out/FIFO selection path. [set]
-  *
-  * @param  ctx     Read / write interface definitions.(ptr)
-  * @param  val     Change the values of "out_sel" in reg CTRL_REG5.
-  * @retval         Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_filter_path_set(const stmdev_ctx_t *ctx,
-                                 i3g4250d_out_sel_t val)
-{
-  i3g4250d_ctrl_reg5_t ctrl_reg5;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
-                          (uint8_t *)&ctrl_reg5, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg5.out_sel = (uint8_t)val & 0x03U;
-    ctrl_reg5.hpen = ((uint8_t)val & 0x04U) >> 2;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG5,
-                             (uint8_t *)&ctrl_reg5, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Out/FIFO selection path. [get]
-  *
-  * @param  ctx     Read / write interface definitions.(ptr)
-  * @param  val     Get the values of out_sel in reg CTRL_REG5.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_filter_path_get(const stmdev_ctx_t *ctx,
-                                 i3g4250d_out_sel_t *val)
-{
-  i3g4250d_ctrl_reg5_t ctrl_reg5;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
-                          (uint8_t *)&ctrl_reg5, 1);
-  if (ret != 0) { return ret; }
-
-  switch ((ctrl_reg5.hpen << 2) + ctrl_reg5.out_sel)
-  {
-    case 0x00:
-      *val = I3G4250D_ONLY_LPF1_ON_OUT;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_LPF1_HP_ON_OUT;
-      break;
-
-    case 0x02:
-      *val = I3G4250D_LPF1_LPF2_ON_OUT;
-      break;
-
-    case 0x06:
-      *val = I3G4250D_LPF1_HP_LPF2_ON_OUT;
-      break;
-
-    default:
-      *val = I3G4250D_ONLY_LPF1_ON_OUT;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Interrupt generator selection path.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int1_sel in reg CTRL_REG5
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_filter_path_internal_set(const stmdev_ctx_t *ctx,
-                                          i3g4250d_int1_sel_t val)
-{
-  i3g4250d_ctrl_reg5_t ctrl_reg5;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
-                          (uint8_t *)&ctrl_reg5, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg5.int1_sel = (uint8_t)val & 0x03U;
-    ctrl_reg5.hpen = ((uint8_t)val & 0x04U) >> 2;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG5,
-                             (uint8_t *)&ctrl_reg5, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Interrupt generator selection path.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int1_sel in reg CTRL_REG5.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_filter_path_internal_get(const stmdev_ctx_t *ctx,
-                                          i3g4250d_int1_sel_t *val)
-{
-  i3g4250d_ctrl_reg5_t ctrl_reg5;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
-                          (uint8_t *)&ctrl_reg5, 1);
-  if (ret != 0) { return ret; }
-
-  switch ((ctrl_reg5.hpen << 2) + ctrl_reg5.int1_sel)
-  {
-    case 0x00:
-      *val = I3G4250D_ONLY_LPF1_ON_INT;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_LPF1_HP_ON_INT;
-      break;
-
-    case 0x02:
-      *val = I3G4250D_LPF1_LPF2_ON_INT;
-      break;
-
-    case 0x06:
-      *val = I3G4250D_LPF1_HP_LPF2_ON_INT;
-      break;
-
-    default:
-      *val = I3G4250D_ONLY_LPF1_ON_INT;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Reference value for high-pass filter.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ref in reg REFERENCE
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_hp_reference_value_set(const stmdev_ctx_t *ctx,
-                                        uint8_t val)
-{
-  i3g4250d_reference_t reference;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_REFERENCE,
-                          (uint8_t *)&reference, 1);
-
-  if (ret == 0)
-  {
-    reference.ref = val;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_REFERENCE,
-                             (uint8_t *)&reference, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Reference value for high-pass filter.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ref in reg REFERENCE.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_hp_reference_value_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val)
-{
-  i3g4250d_reference_t reference;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_REFERENCE,
-                          (uint8_t *)&reference, 1);
-  if (ret != 0) { return ret; }
-
-  *val = reference.ref;
-
-  return ret;
-}
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   I3G4250D_serial_interface
-  * @brief   This section groups all the functions concerning main serial
-  *          interface management.
-  * @{
-  *
-  */
-
-/**
-  * @brief  SPI Serial Interface Mode selection.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sim in reg CTRL_REG4
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_spi_mode_set(const stmdev_ctx_t *ctx, i3g4250d_sim_t val)
-{
-  i3g4250d_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
-                          (uint8_t *)&ctrl_reg4, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg4.sim = (uint8_t)val & 0x01U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
-                             (uint8_t *)&ctrl_reg4, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  SPI Serial Interface Mode selection.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of sim in reg CTRL_REG4.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_spi_mode_get(const stmdev_ctx_t *ctx, i3g4250d_sim_t *val)
-{
-  i3g4250d_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
-                          (uint8_t *)&ctrl_reg4, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg4.sim)
-  {
-    case 0x00:
-      *val = I3G4250D_SPI_4_WIRE;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_SPI_3_WIRE;
-      break;
-
-    default:
-      *val = I3G4250D_SPI_4_WIRE;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   I3G4250D_interrupt_pins
-  * @brief      This section groups all the functions that manage interrupt pins
-  * @{
-  *
-  */
-
-
-/**
-  * @brief  Select the signal that need to route on int1 pad.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Configure CTRL_REG3 int1 pad
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_pin_int1_route_set(const stmdev_ctx_t *ctx,
-                                    i3g4250d_int1_route_t val)
-{
-  i3g4250d_ctrl_reg3_t ctrl_reg3;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
-                          (uint8_t *)&ctrl_reg3, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg3.i1_int1         = val.i1_int1;
-    ctrl_reg3.i1_boot         = val.i1_boot;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG3,
-                             (uint8_t *)&ctrl_reg3, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Select the signal that need to route on int1 pad.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Read CTRL_REG3 int1 pad.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-
-int32_t i3g4250d_pin_int1_route_get(const stmdev_ctx_t *ctx,
-                                    i3g4250d_int1_route_t *val)
-{
-  i3g4250d_ctrl_reg3_t ctrl_reg3;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
-                          (uint8_t *)&ctrl_reg3, 1);
-  if (ret != 0) { return ret; }
-
-  val->i1_int1       = ctrl_reg3.i1_int1;
-  val->i1_boot       = ctrl_reg3.i1_boot;
-
-  return ret;
-}
-/**
-  * @brief  Select the signal that need to route on int2 pad.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Configure CTRL_REG3 int2 pad
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_pin_int2_route_set(const stmdev_ctx_t *ctx,
-                                    i3g4250d_int2_route_t val)
-{
-  i3g4250d_ctrl_reg3_t ctrl_reg3;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
-                          (uint8_t *)&ctrl_reg3, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg3.i2_empty         = val.i2_empty;
-    ctrl_reg3.i2_orun          = val.i2_orun;
-    ctrl_reg3.i2_wtm           = val.i2_wtm;
-    ctrl_reg3.i2_drdy          = val.i2_drdy;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG3,
-                             (uint8_t *)&ctrl_reg3, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Select the signal that need to route on int2 pad.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Read CTRL_REG3 int2 pad.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_pin_int2_route_get(const stmdev_ctx_t *ctx,
-                                    i3g4250d_int2_route_t *val)
-{
-  i3g4250d_ctrl_reg3_t ctrl_reg3;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
-                          (uint8_t *)&ctrl_reg3, 1);
-  if (ret != 0) { return ret; }
-
-  val->i2_empty       = ctrl_reg3.i2_empty;
-  val->i2_orun        = ctrl_reg3.i2_orun;
-  val->i2_wtm         = ctrl_reg3.i2_wtm;
-  val->i2_drdy        = ctrl_reg3.i2_drdy;
-
-  return ret;
-}
-/**
-  * @brief  Push-pull/open drain selection on interrupt pads.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of pp_od in reg CTRL_REG3
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-
-int32_t i3g4250d_pin_mode_set(const stmdev_ctx_t *ctx, i3g4250d_pp_od_t val)
-{
-  i3g4250d_ctrl_reg3_t ctrl_reg3;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
-                          (uint8_t *)&ctrl_reg3, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg3.pp_od = (uint8_t)val & 0x01U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG3,
-                             (uint8_t *)&ctrl_reg3, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Push-pull/open drain selection on interrupt pads.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of pp_od in reg CTRL_REG3.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_pin_mode_get(const stmdev_ctx_t *ctx,
-                              i3g4250d_pp_od_t *val)
-{
-  i3g4250d_ctrl_reg3_t ctrl_reg3;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
-                          (uint8_t *)&ctrl_reg3, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg3.pp_od)
-  {
-    case 0x00:
-      *val = I3G4250D_PUSH_PULL;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_OPEN_DRAIN;
-      break;
-
-    default:
-      *val = I3G4250D_PUSH_PULL;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Pin active-high/low.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of h_lactive in reg CTRL_REG3.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_pin_polarity_set(const stmdev_ctx_t *ctx,
-                                  i3g4250d_h_lactive_t val)
-{
-  i3g4250d_ctrl_reg3_t ctrl_reg3;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
-                          (uint8_t *)&ctrl_reg3, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg3.h_lactive = (uint8_t)val & 0x01U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG3,
-                             (uint8_t *)&ctrl_reg3, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Pin active-high/low.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of h_lactive in reg CTRL_REG3.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_pin_polarity_get(const stmdev_ctx_t *ctx,
-                                  i3g4250d_h_lactive_t *val)
-{
-  i3g4250d_ctrl_reg3_t ctrl_reg3;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
-                          (uint8_t *)&ctrl_reg3, 1);
-  if (ret != 0) { return ret; }
-
-  switch (ctrl_reg3.h_lactive)
-  {
-    case 0x00:
-      *val = I3G4250D_ACTIVE_HIGH;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_ACTIVE_LOW;
-      break;
-
-    default:
-      *val = I3G4250D_ACTIVE_HIGH;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Latched/pulsed interrupt.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of lir in reg INT1_CFG.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_notification_set(const stmdev_ctx_t *ctx,
-                                      i3g4250d_lir_t val)
-{
-  i3g4250d_int1_cfg_t int1_cfg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
-
-  if (ret == 0)
-  {
-    int1_cfg.lir = (uint8_t)val & 0x01U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Latched/pulsed interrupt.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of lir in reg INT1_CFG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_notification_get(const stmdev_ctx_t *ctx,
-                                      i3g4250d_lir_t *val)
-{
-  i3g4250d_int1_cfg_t int1_cfg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
-  if (ret != 0) { return ret; }
-
-  switch (int1_cfg.lir)
-  {
-    case 0x00:
-      *val = I3G4250D_INT_PULSED;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_INT_LATCHED;
-      break;
-
-    default:
-      *val = I3G4250D_INT_PULSED;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   I3G4250D_ interrupt_on_threshold
-  * @brief      This section groups all the functions that manage the event
-  *             generation on threshold.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Configure the interrupt threshold sign.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Struct of registers INT1_CFG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_on_threshold_conf_set(const stmdev_ctx_t *ctx,
-                                           i3g4250d_int1_cfg_t *val)
-{
-  int32_t ret;
-
-  ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *) val, 1);
-
-  return ret;
-}
-
-/**
-  * @brief  Configure the interrupt threshold sign.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Struct of registers from INT1_CFG to.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_on_threshold_conf_get(const stmdev_ctx_t *ctx,
-                                           i3g4250d_int1_cfg_t *val)
-{
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *) val, 1);
-
-  return ret;
-}
-/**
-  * @brief  AND/OR combination of interrupt events.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of and_or in reg INT1_CFG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_on_threshold_mode_set(const stmdev_ctx_t *ctx,
-                                           i3g4250d_and_or_t val)
-{
-  i3g4250d_int1_cfg_t int1_cfg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
-
-  if (ret == 0)
-  {
-    int1_cfg.and_or = (uint8_t)val & 0x01U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  AND/OR combination of interrupt events.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of and_or in reg INT1_CFG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_on_threshold_mode_get(const stmdev_ctx_t *ctx,
-                                           i3g4250d_and_or_t *val)
-{
-  i3g4250d_int1_cfg_t int1_cfg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
-  if (ret != 0) { return ret; }
-
-  switch (int1_cfg.and_or)
-  {
-    case 0x00:
-      *val = I3G4250D_INT1_ON_TH_OR;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_INT1_ON_TH_AND;
-      break;
-
-    default:
-      *val = I3G4250D_INT1_ON_TH_OR;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief   int_on_threshold_src: [get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Union of registers from INT1_SRC to.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_on_threshold_src_get(const stmdev_ctx_t *ctx,
-                                          i3g4250d_int1_src_t *val)
-{
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_SRC, (uint8_t *) val, 1);
-
-  return ret;
-}
-
-/**
-  * @brief  Interrupt threshold on X.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of thsx in reg INT1_TSH_XH
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_x_threshold_set(const stmdev_ctx_t *ctx, uint16_t val)
-{
-  i3g4250d_int1_tsh_xh_t int1_tsh_xh;
-  i3g4250d_int1_tsh_xl_t int1_tsh_xl;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XH,
-                          (uint8_t *)&int1_tsh_xh, 1);
-
-  if (ret == 0)
-  {
-    int1_tsh_xh.thsx = (uint8_t)(val / 256U) & 0x7FU;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_XH,
-                             (uint8_t *)&int1_tsh_xh, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XL,
-                            (uint8_t *)&int1_tsh_xl, 1);
-  }
-
-  if (ret == 0)
-  {
-    int1_tsh_xl.thsx = (uint8_t)(val - (int1_tsh_xh.thsx * 256U));
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_XL,
-                             (uint8_t *)&int1_tsh_xl, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Interrupt threshold on X.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of thsx in reg INT1_TSH_XH.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_x_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val)
-{
-  i3g4250d_int1_tsh_xh_t int1_tsh_xh;
-  i3g4250d_int1_tsh_xl_t int1_tsh_xl;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XH,
-                          (uint8_t *)&int1_tsh_xh, 1);
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XL,
-                            (uint8_t *)&int1_tsh_xl, 1);
-    if (ret != 0) { return ret; }
-
-    *val = int1_tsh_xh.thsx;
-    *val = *val * 256U;
-    *val +=  int1_tsh_xl.thsx;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Interrupt threshold on Y.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of thsy in reg INT1_TSH_YH
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_y_threshold_set(const stmdev_ctx_t *ctx, uint16_t val)
-{
-  i3g4250d_int1_tsh_yh_t int1_tsh_yh;
-  i3g4250d_int1_tsh_yl_t int1_tsh_yl;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_YH,
-                          (uint8_t *)&int1_tsh_yh, 1);
-  int1_tsh_yh.thsy = (uint8_t)(val / 256U) & 0x7FU;
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_YH,
-                             (uint8_t *)&int1_tsh_yh, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_YL,
-                            (uint8_t *)&int1_tsh_yl, 1);
-    int1_tsh_yl.thsy = (uint8_t)(val - (int1_tsh_yh.thsy * 256U));
-  }
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_YL,
-                             (uint8_t *)&int1_tsh_yl, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Interrupt threshold on Y.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of thsy in reg INT1_TSH_YH.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_y_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val)
-{
-  i3g4250d_int1_tsh_yh_t int1_tsh_yh;
-  i3g4250d_int1_tsh_yl_t int1_tsh_yl;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_YH,
-                          (uint8_t *)&int1_tsh_yh, 1);
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_YL,
-                            (uint8_t *)&int1_tsh_yl, 1);
-    if (ret != 0) { return ret; }
-
-    *val = int1_tsh_yh.thsy;
-    *val = *val * 256U;
-    *val += int1_tsh_yl.thsy;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Interrupt threshold on Z.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of thsz in reg INT1_TSH_ZH.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_z_threshold_set(const stmdev_ctx_t *ctx, uint16_t val)
-{
-  i3g4250d_int1_tsh_zh_t int1_tsh_zh;
-  i3g4250d_int1_tsh_zl_t int1_tsh_zl;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_ZH,
-                          (uint8_t *)&int1_tsh_zh, 1);
-  int1_tsh_zh.thsz = (uint8_t)(val / 256U) & 0x7FU;;
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_ZH,
-                             (uint8_t *)&int1_tsh_zh, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_ZL,
-                            (uint8_t *)&int1_tsh_zl, 1);
-    int1_tsh_zl.thsz = (uint8_t)(val - (int1_tsh_zh.thsz * 256U));
-  }
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_ZL,
-                             (uint8_t *)&int1_tsh_zl, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Interrupt threshold on Z.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of thsz in reg INT1_TSH_ZH.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_z_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val)
-{
-  i3g4250d_int1_tsh_zh_t int1_tsh_zh;
-  i3g4250d_int1_tsh_zl_t int1_tsh_zl;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_ZH,
-                          (uint8_t *)&int1_tsh_zh, 1);
-
-  if (ret == 0)
-  {
-    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_ZL,
-                            (uint8_t *)&int1_tsh_zl, 1);
-    if (ret != 0) { return ret; }
-
-    *val = int1_tsh_zh.thsz;
-    *val = *val * 256U;
-    *val += int1_tsh_zl.thsz;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Durationvalue.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of d in reg INT1_DURATION
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_on_threshold_dur_set(const stmdev_ctx_t *ctx,
-                                          uint8_t val)
-{
-  i3g4250d_int1_duration_t int1_duration;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_DURATION,
-                          (uint8_t *)&int1_duration, 1);
-
-  if (ret == 0)
-  {
-    int1_duration.d = val & 0x7FU;
-
-    if (val != PROPERTY_DISABLE)
-    {
-      int1_duration.wait = PROPERTY_ENABLE;
-    }
-
-    else
-    {
-      int1_duration.wait = PROPERTY_DISABLE;
-    }
-
-    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_DURATION,
-                             (uint8_t *)&int1_duration, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Durationvalue.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of d in reg INT1_DURATION.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_int_on_threshold_dur_get(const stmdev_ctx_t *ctx,
-                                          uint8_t *val)
-{
-  i3g4250d_int1_duration_t int1_duration;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_DURATION,
-                          (uint8_t *)&int1_duration, 1);
-  if (ret != 0) { return ret; }
-
-  *val = int1_duration.d;
-
-  return ret;
-}
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   I3G4250D_fifo
-  * @brief   This section group all the functions concerning the fifo usage
-  * @{
-  *
-  */
-
-/**
-  * @brief  FIFOenable.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fifo_en in reg CTRL_REG5
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_enable_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  i3g4250d_ctrl_reg5_t ctrl_reg5;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
-                          (uint8_t *)&ctrl_reg5, 1);
-
-  if (ret == 0)
-  {
-    ctrl_reg5.fifo_en = val & 0x01U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG5,
-                             (uint8_t *)&ctrl_reg5, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  FIFOenable.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fifo_en in reg CTRL_REG5.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_enable_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  i3g4250d_ctrl_reg5_t ctrl_reg5;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
-                          (uint8_t *)&ctrl_reg5, 1);
-  if (ret != 0) { return ret; }
-
-  *val = ctrl_reg5.fifo_en;
-
-  return ret;
-}
-
-/**
-  * @brief  FIFO watermark level selection.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of wtm in reg FIFO_CTRL_REG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_watermark_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  i3g4250d_fifo_ctrl_reg_t fifo_ctrl_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG,
-                          (uint8_t *)&fifo_ctrl_reg, 1);
-
-  if (ret == 0)
-  {
-    fifo_ctrl_reg.wtm = val & 0x1FU;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_FIFO_CTRL_REG,
-                             (uint8_t *)&fifo_ctrl_reg, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  FIFO watermark level selection.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of wtm in reg FIFO_CTRL_REG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_watermark_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  i3g4250d_fifo_ctrl_reg_t fifo_ctrl_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG,
-                          (uint8_t *)&fifo_ctrl_reg, 1);
-  if (ret != 0) { return ret; }
-
-  *val = fifo_ctrl_reg.wtm;
-
-  return ret;
-}
-
-/**
-  * @brief  FIFO mode selection.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fm in reg FIFO_CTRL_REG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_mode_set(const stmdev_ctx_t *ctx,
-                               i3g4250d_fifo_mode_t val)
-{
-  i3g4250d_fifo_ctrl_reg_t fifo_ctrl_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG,
-                          (uint8_t *)&fifo_ctrl_reg, 1);
-
-  if (ret == 0)
-  {
-    fifo_ctrl_reg.fm = (uint8_t)val & 0x07U;
-    ret = i3g4250d_write_reg(ctx, I3G4250D_FIFO_CTRL_REG,
-                             (uint8_t *)&fifo_ctrl_reg, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  FIFO mode selection.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fm in reg FIFO_CTRL_REG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_mode_get(const stmdev_ctx_t *ctx,
-                               i3g4250d_fifo_mode_t *val)
-{
-  i3g4250d_fifo_ctrl_reg_t fifo_ctrl_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG,
-                          (uint8_t *)&fifo_ctrl_reg, 1);
-  if (ret != 0) { return ret; }
-
-  switch (fifo_ctrl_reg.fm)
-  {
-    case 0x00:
-      *val = I3G4250D_FIFO_BYPASS_MODE;
-      break;
-
-    case 0x01:
-      *val = I3G4250D_FIFO_MODE;
-      break;
-
-    case 0x02:
-      *val = I3G4250D_FIFO_STREAM_MODE;
-      break;
-
-    default:
-      *val = I3G4250D_FIFO_BYPASS_MODE;
-      break;
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  FIFO stored data level[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fss in reg FIFO_SRC_REG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_data_level_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  i3g4250d_fifo_src_reg_t fifo_src_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
-                          (uint8_t *)&fifo_src_reg, 1);
-  if (ret != 0) { return ret; }
-
-  *val = fifo_src_reg.fss;
-
-  return ret;
-}
-
-/**
-  * @brief  FIFOemptybit.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of empty in reg FIFO_SRC_REG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_empty_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  i3g4250d_fifo_src_reg_t fifo_src_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
-                          (uint8_t *)&fifo_src_reg, 1);
-  if (ret != 0) { return ret; }
-
-  *val = fifo_src_reg.empty;
-
-  return ret;
-}
-
-/**
-  * @brief  Overrun bit status.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ovrn in reg FIFO_SRC_REG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t i3g4250d_fifo_ovr_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  i3g4250d_fifo_src_reg_t fifo_src_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
-                          (uint8_t *)&fifo_src_reg, 1);
-  if (ret != 0) { return ret; }
-
-  *val = fifo_src_reg.ovrn;
-
-  return ret;
-}
-
-/**
-  * @brief  Watermark status:[get]
-  *                0: FIFO filling is lower than WTM level;
-  *                1: FIFO filling is equal or higher than WTM level)
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of wtm in reg FIFO_SRC_REG.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-
-int32_t i3g4250d_fifo_wtm_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  i3g4250d_fifo_src_reg_t fifo_src_reg;
-  int32_t ret;
-
-  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
-                          (uint8_t *)&fifo_src_reg, 1);
-  if (ret != 0) { return ret; }
-
-  *val = fifo_src_reg.wtm;
-
-  return ret;
-}
-
-/**
-  * @}
-  *
-  */
+/**
+  ******************************************************************************
+  * @file    i3g4250d_reg.c
+  * @author  Sensors Software Solution Team
+  * @brief   I3G4250D driver file
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_reg.h"
+#include <string.h>
+
+/**
+  * @defgroup    I3G4250D
+  * @brief       This file provides a set of functions needed to drive the
+  *              i3g4250d enhanced inertial module.
+  * @{
+  *
+  */
+
+/**
+  * @defgroup    I3G4250D_Interfaces_Functions
+  * @brief       This section provide a set of functions used to read and
+  *              write a generic register of the device.
+  *              MANDATORY: return 0 -> no Error.
+  * @{
+  *
+  */
+
+/*
+ * Accesses to the cached registers, published with a sequence counter:
+ * writers (serialized by the bus lock) make it odd during an update,
+ * readers retry when it was odd or changed. Loads are acquire and
+ * stores release, so a reader seeing a new byte also sees the odd
+ * counter. GCC and Clang builtins give this ordering on multi-core
+ * targets; other compilers fall back to volatile accesses, enough on
+ * single-core targets. A platform can provide its own definitions.
+ */
+#ifndef I3G4250D_SEQ_LOAD
+#if defined(__GNUC__)
+#define I3G4250D_SEQ_LOAD(p)           __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define I3G4250D_SEQ_STORE(p, v)       __atomic_store_n((p), (v), \
+                                                        __ATOMIC_RELEASE)
+#else
+#define I3G4250D_SEQ_LOAD(p)           (*(p))
+#define I3G4250D_SEQ_STORE(p, v)       (*(p) = (v))
+#endif /* __GNUC__ */
+#endif /* I3G4250D_SEQ_LOAD */
+
+/* reader attempts before falling back to the bus lock */
+#define I3G4250D_SEQ_RETRY               16U
+
+/**
+  * @brief  Sub-address sent on the bus: for multi-byte transactions the
+  *         auto-increment bit is added according to the bus declared in
+  *         the driver private data (bit 7 on I2C, bit 6 on SPI).
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  reg   register address
+  * @param  len   number of consecutive register to access
+  * @retval       sub-address
+  *
+  */
+static uint8_t i3g4250d_sub_address(const stmdev_ctx_t *ctx, uint8_t reg,
+                                    uint16_t len)
+{
+  const i3g4250d_priv_t *priv = (const i3g4250d_priv_t *)ctx->priv_data;
+  uint8_t sub = reg;
+
+  if ((priv != NULL) && (len > 1U))
+  {
+    if (priv->bus == (uint8_t)I3G4250D_BUS_I2C)
+    {
+      sub |= I3G4250D_I2C_AUTO_INCREMENT;
+    }
+    else if (priv->bus == (uint8_t)I3G4250D_BUS_SPI)
+    {
+      sub |= I3G4250D_SPI_AUTO_INCREMENT;
+    }
+    else
+    {
+      /* auto-increment bit managed by the platform functions */
+    }
+  }
+
+  return sub;
+}
+
+/**
+  * @brief  Take a lock declared in the driver private data.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  id    I3G4250D_LOCK_BUS, or register address of a
+  *               read-modify-write sequence
+  *
+  */
+static void i3g4250d_lock(const stmdev_ctx_t *ctx, uint8_t id)
+{
+  const i3g4250d_priv_t *priv;
+
+  if (ctx == NULL) { return; }
+
+  priv = (const i3g4250d_priv_t *)ctx->priv_data;
+
+  if ((priv != NULL) && (priv->lock.lock != NULL))
+  {
+    priv->lock.lock(priv->lock.handle, id);
+  }
+}
+
+/**
+  * @brief  Release a lock declared in the driver private data.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  id    I3G4250D_LOCK_BUS, or register address of a
+  *               read-modify-write sequence
+  *
+  */
+static void i3g4250d_unlock(const stmdev_ctx_t *ctx, uint8_t id)
+{
+  const i3g4250d_priv_t *priv;
+
+  if (ctx == NULL) { return; }
+
+  priv = (const i3g4250d_priv_t *)ctx->priv_data;
+
+  if ((priv != NULL) && (priv->lock.unlock != NULL))
+  {
+    priv->lock.unlock(priv->lock.handle, id);
+  }
+}
+
+/**
+  * @brief  Start an update of the cached registers. To be called with
+  *         the bus lock held.
+  *
+  * @param  priv  driver private data(ptr)
+  *
+  */
+static void i3g4250d_seq_begin(i3g4250d_priv_t *priv)
+{
+  uint32_t seq = I3G4250D_SEQ_LOAD(&priv->seq);
+
+  I3G4250D_SEQ_STORE(&priv->seq, seq + 1U);
+}
+
+/**
+  * @brief  Publish an update of the cached registers.
+  *
+  * @param  priv  driver private data(ptr)
+  *
+  */
+static void i3g4250d_seq_end(i3g4250d_priv_t *priv)
+{
+  uint32_t seq = I3G4250D_SEQ_LOAD(&priv->seq);
+
+  I3G4250D_SEQ_STORE(&priv->seq, seq + 1U);
+}
+
+/**
+  * @brief  Update the CTRL_REG1..CTRL_REG5 shadow with the content of a
+  *         completed transaction. Called with the bus lock held; the
+  *         readers don't take it (see i3g4250d_seq_begin).
+  *         Consecutive registers are accessed only when the driver sets
+  *         the auto-increment bit (bus declared with
+  *         i3g4250d_bus_mode_set); otherwise only the first byte is
+  *         known to come from the addressed register.
+  *
+  * @param  priv  driver private data(ptr)
+  * @param  sub   sub-address
+  * @param  data  buffer(ptr)
+  * @param  len   number of consecutive register accessed
+  *
+  */
+static void i3g4250d_ctrl_cache(i3g4250d_priv_t *priv, uint8_t sub,
+                                const uint8_t *data, uint16_t len)
+{
+  uint8_t addr = sub & 0x3FU;
+  uint8_t valid;
+  uint16_t num = len;
+  uint16_t i;
+
+  if ((priv->bus == (uint8_t)I3G4250D_BUS_USER) && (num > 1U))
+  {
+    num = 1U;
+  }
+
+  if ((addr > I3G4250D_CTRL_REG5) ||
+      ((addr + (uint32_t)num) <= I3G4250D_CTRL_REG1))
+  {
+    return;
+  }
+
+  i3g4250d_seq_begin(priv);
+  valid = I3G4250D_SEQ_LOAD(&priv->ctrl_valid);
+
+  for (i = 0U; (i < num) && (addr <= I3G4250D_CTRL_REG5); i++)
+  {
+    if (addr >= I3G4250D_CTRL_REG1)
+    {
+      I3G4250D_SEQ_STORE(&priv->ctrl_reg[addr - I3G4250D_CTRL_REG1],
+                         data[i]);
+      valid |= (uint8_t)(1U << (addr - I3G4250D_CTRL_REG1));
+    }
+
+    addr++;
+  }
+
+  I3G4250D_SEQ_STORE(&priv->ctrl_valid, valid);
+  i3g4250d_seq_end(priv);
+}
+
+/**
+  * @brief  A read of these registers has side effects: the output
+  *         registers pop the FIFO when it is enabled, INT1_SRC clears
+  *         the latched event. Repeating it would lose data.
+  *
+  * @param  sub   sub-address
+  * @param  len   number of consecutive register read
+  * @retval       1: read with side effects; 0: otherwise
+  *
+  */
+static uint8_t i3g4250d_read_consumes(uint8_t sub, uint16_t len)
+{
+  uint32_t first = (uint32_t)sub & 0x3FU;
+  uint32_t last = first + len - 1U;
+  uint8_t ret = 0U;
+
+  if ((len > 0U) &&
+      (((first <= I3G4250D_OUT_Z_H) && (last >= I3G4250D_OUT_X_L)) ||
+       ((first <= I3G4250D_INT1_SRC) && (last >= I3G4250D_INT1_SRC))))
+  {
+    ret = 1U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Bus transaction with the retry policy declared in the driver
+  *         private data: bounded retries with exponential backoff
+  *         through ctx->mdelay, drawn from a per-context budget that a
+  *         transaction succeeding at first attempt refills by one.
+  *         When the allowed retries fail the bus recovery function, if
+  *         any, is called before a last attempt.
+  *         Register writes can be repeated safely. Reads with side
+  *         effects (output registers / FIFO, INT1_SRC) are never
+  *         repeated: a failure may have popped samples or cleared the
+  *         event, so it is returned and counted as unrecoverable.
+  *         The whole sequence holds the bus lock, if declared.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  sub   sub-address
+  * @param  data  buffer(ptr)
+  * @param  len   number of consecutive register to access
+  * @param  write PROPERTY_ENABLE for a write transaction
+  * @retval       interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+static int32_t i3g4250d_transfer(const stmdev_ctx_t *ctx, uint8_t sub,
+                                 uint8_t *data, uint16_t len, uint8_t write)
+{
+  i3g4250d_priv_t *priv = (i3g4250d_priv_t *)ctx->priv_data;
+  uint32_t delay;
+  uint8_t attempt;
+  int32_t ret;
+
+  if (priv == NULL)
+  {
+    ret = (write == PROPERTY_ENABLE) ?
+          ctx->write_reg(ctx->handle, sub, data, len) :
+          ctx->read_reg(ctx->handle, sub, data, len);
+
+    return ret;
+  }
+
+  i3g4250d_lock(ctx, I3G4250D_LOCK_BUS);
+
+  ret = (write == PROPERTY_ENABLE) ?
+        ctx->write_reg(ctx->handle, sub, data, len) :
+        ctx->read_reg(ctx->handle, sub, data, len);
+
+  if (ret == 0)
+  {
+    if (priv->tokens < priv->retry.budget)
+    {
+      priv->tokens++;
+    }
+
+    i3g4250d_ctrl_cache(priv, sub, data, len);
+    i3g4250d_unlock(ctx, I3G4250D_LOCK_BUS);
+
+    return ret;
+  }
+
+  priv->stats.errors++;
+
+  if ((write != PROPERTY_ENABLE) && (i3g4250d_read_consumes(sub, len) != 0U))
+  {
+    priv->stats.unrecoverable++;
+    priv->stats.failed++;
+    i3g4250d_unlock(ctx, I3G4250D_LOCK_BUS);
+
+    return ret;
+  }
+
+  delay = priv->retry.backoff_ms;
+
+  for (attempt = 0U; (ret != 0) && (attempt < priv->retry.retries) &&
+       (priv->tokens > 0U); attempt++)
+  {
+    priv->tokens--;
+
+    if ((ctx->mdelay != NULL) && (delay > 0U))
+    {
+      ctx->mdelay(delay);
+      delay *= 2U;
+    }
+
+    ret = (write == PROPERTY_ENABLE) ?
+          ctx->write_reg(ctx->handle, sub, data, len) :
+          ctx->read_reg(ctx->handle, sub, data, len);
+
+    if (ret != 0)
+    {
+      priv->stats.errors++;
+    }
+
+    else
+    {
+      priv->stats.retried++;
+    }
+  }
+
+  /* still failing after the allowed retries: bus assumed stuck */
+  if ((ret != 0) && (priv->retry.retries > 0U) &&
+      (priv->retry.recover != NULL) && (priv->retry.recover(ctx->handle) == 0))
+  {
+    ret = (write == PROPERTY_ENABLE) ?
+          ctx->write_reg(ctx->handle, sub, data, len) :
+          ctx->read_reg(ctx->handle, sub, data, len);
+
+    if (ret != 0)
+    {
+      priv->stats.errors++;
+    }
+
+    else
+    {
+      priv->stats.recovered++;
+    }
+  }
+
+  if (ret != 0)
+  {
+    priv->stats.failed++;
+  }
+
+  else
+  {
+    i3g4250d_ctrl_cache(priv, sub, data, len);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_LOCK_BUS);
+
+  return ret;
+}
+
+/**
+  * @brief  Read generic device register
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  reg   register to read
+  * @param  data  pointer to buffer that store the data read(ptr)
+  * @param  len   number of consecutive register to read
+  *               (if the bus is declared with i3g4250d_bus_mode_set the
+  *               multi-byte auto-increment bit is set by the driver)
+  * @retval       interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t __weak i3g4250d_read_reg(const stmdev_ctx_t *ctx, uint8_t reg,
+                                 uint8_t *data,
+                                 uint16_t len)
+{
+  int32_t ret;
+
+  if (ctx == NULL) return -1;
+
+  ret = i3g4250d_transfer(ctx, i3g4250d_sub_address(ctx, reg, len),
+                          data, len, PROPERTY_DISABLE);
+
+  return ret;
+}
+
+/**
+  * @brief  Write generic device register
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  reg   register to write
+  * @param  data  pointer to data to write in register reg(ptr)
+  * @param  len   number of consecutive register to write
+  *               (if the bus is declared with i3g4250d_bus_mode_set the
+  *               multi-byte auto-increment bit is set by the driver)
+  * @retval       interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t __weak i3g4250d_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
+                                  uint8_t *data,
+                                  uint16_t len)
+{
+  int32_t ret;
+
+  if (ctx == NULL) return -1;
+
+  ret = i3g4250d_transfer(ctx, i3g4250d_sub_address(ctx, reg, len),
+                          data, len, PROPERTY_ENABLE);
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup    I3G4250D_Private_functions
+  * @brief       Internal helpers shared by the data output functions.
+  * @{
+  *
+  */
+
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+#define I3G4250D_HOST_BLE                I3G4250D_AUX_LSB_AT_LOW_ADD
+#else
+#define I3G4250D_HOST_BLE                I3G4250D_AUX_MSB_AT_LOW_ADD
+#endif /* DRV_BYTE_ORDER */
+
+/**
+  * @brief  Sensitivity of the selected full scale.
+  *
+  * @param  fs    value of fs in reg CTRL_REG4
+  * @retval       sensitivity [mdps/LSB]
+  *
+  */
+static float_t i3g4250d_sensitivity_mdps(uint8_t fs)
+{
+  float_t sens;
+
+  switch (fs)
+  {
+    case 0x01:
+      sens = 17.50f;
+      break;
+
+    case 0x02:
+    case 0x03:
+      sens = 70.0f;
+      break;
+
+    default:
+      sens = 8.75f;
+      break;
+  }
+
+  return sens;
+}
+
+/**
+  * @brief  Output data rate of the given configuration.
+  *
+  * @param  ctrl_reg1  content of reg CTRL_REG1
+  * @retval            output data rate [Hz], 0 when no data is generated
+  *                    (power-down or sleep mode)
+  *
+  */
+static float_t i3g4250d_odr_hz(i3g4250d_ctrl_reg1_t ctrl_reg1)
+{
+  float_t odr;
+
+  switch ((ctrl_reg1.dr << 4) + ctrl_reg1.pd)
+  {
+    case 0x0F:
+      odr = 100.0f;
+      break;
+
+    case 0x1F:
+      odr = 200.0f;
+      break;
+
+    case 0x2F:
+      odr = 400.0f;
+      break;
+
+    case 0x3F:
+      odr = 800.0f;
+      break;
+
+    default:
+      odr = 0.0f;
+      break;
+  }
+
+  return odr;
+}
+
+/**
+  * @brief  Device byte order, as cached in the driver private data.
+  *         Without private data the power-up default (LSB at lower
+  *         address) is assumed. A single byte, read without lock.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @retval       cached value of "ble" in reg CTRL_REG4
+  *
+  */
+static uint8_t i3g4250d_ble_cached(const stmdev_ctx_t *ctx)
+{
+  const i3g4250d_priv_t *priv;
+  uint8_t ble = (uint8_t)I3G4250D_AUX_LSB_AT_LOW_ADD;
+
+  if (ctx != NULL)
+  {
+    priv = (const i3g4250d_priv_t *)ctx->priv_data;
+    if (priv != NULL)
+    {
+      ble = I3G4250D_SEQ_LOAD(&priv->ble);
+    }
+  }
+
+  return ble;
+}
+
+/**
+  * @brief  Swap in place the two bytes of each 16-bit word. Two words are
+  *         processed at a time in a single 32-bit register.
+  *
+  * @param  val   buffer of 16-bit words(ptr)
+  * @param  num   number of 16-bit words in the buffer
+  *
+  */
+static void i3g4250d_swap16(int16_t *val, uint16_t num)
+{
+  uint32_t word;
+  uint16_t half;
+  uint16_t i = 0U;
+
+  for (; (uint16_t)(i + 1U) < num; i += 2U)
+  {
+    (void)memcpy(&word, &val[i], sizeof(word));
+    word = ((word & 0x00FF00FFU) << 8) | ((word >> 8) & 0x00FF00FFU);
+    (void)memcpy(&val[i], &word, sizeof(word));
+  }
+
+  if (i < num)
+  {
+    half = (uint16_t)val[i];
+    half = (uint16_t)((half << 8) | (half >> 8));
+    val[i] = (int16_t)half;
+  }
+}
+
+/**
+  * @brief  Number of samples stored in FIFO.
+  *
+  * @param  fifo_src_reg  content of reg FIFO_SRC_REG(ptr)
+  * @retval               number of samples (0 to I3G4250D_FIFO_DEPTH)
+  *
+  */
+static uint8_t i3g4250d_fifo_level(const i3g4250d_fifo_src_reg_t *fifo_src_reg)
+{
+  uint8_t level;
+
+  if (fifo_src_reg->empty == PROPERTY_ENABLE)
+  {
+    level = 0U;
+  }
+
+  else if (fifo_src_reg->ovrn == PROPERTY_ENABLE)
+  {
+    level = (uint8_t)I3G4250D_FIFO_DEPTH;
+  }
+
+  else
+  {
+    level = fifo_src_reg->fss;
+  }
+
+  return level;
+}
+
+/**
+  * @brief  Current content of a control register, from the register
+  *         shadow when available, otherwise read from the device. To be
+  *         called with the register lock held for a read-modify-write.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  reg   I3G4250D_CTRL_REG1 to I3G4250D_CTRL_REG5
+  * @param  val   register content(ptr)
+  * @retval       interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+static int32_t i3g4250d_ctrl_reg_current(const stmdev_ctx_t *ctx,
+                                         uint8_t reg, uint8_t *val)
+{
+  if (i3g4250d_ctrl_reg_cached_get(ctx, reg, val) == 0) { return 0; }
+
+  return i3g4250d_read_reg(ctx, reg, val, 1);
+}
+
+/**
+  * @brief  Convert in place raw output words, read from the device
+  *         straight into the caller buffer, to host byte order.
+  *         Nothing is done when the device byte order already matches
+  *         the host one.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  val   buffer of 16-bit words read from the device(ptr)
+  * @param  num   number of 16-bit words in the buffer
+  *
+  */
+static void i3g4250d_raw_to_host(const stmdev_ctx_t *ctx, int16_t *val,
+                                 uint16_t num)
+{
+  if (i3g4250d_ble_cached(ctx) != (uint8_t)I3G4250D_HOST_BLE)
+  {
+    i3g4250d_swap16(val, num);
+  }
+}
+
+#if (I3G4250D_SOA_SIMD != 0)
+typedef uint16_t i3g4250d_v8u16_t __attribute__((vector_size(16)));
+#define I3G4250D_SOA_INLINE    static inline __attribute__((always_inline))
+
+/**
+  * @brief  Load 8 words of the block, in host byte order.
+  *
+  * @param  buf   first word(ptr)
+  * @param  swap  0: device byte order is the host one; 1: swap bytes
+  * @retval       words
+  *
+  */
+I3G4250D_SOA_INLINE i3g4250d_v8u16_t i3g4250d_soa_load(const uint8_t *buf,
+                                                       uint8_t swap)
+{
+  i3g4250d_v8u16_t v;
+
+  (void)memcpy(&v, buf, sizeof(v));
+  if (swap != 0U)
+  {
+    v = (v << 8) | (v >> 8);
+  }
+
+  return v;
+}
+
+/**
+  * @brief  One round of the 3-way deinterleave of the 24 words held in
+  *         p, q, r: they become p.lo:q.hi, p.hi:r.lo and q.lo:r.hi, each
+  *         pair interleaved word by word. After three rounds X Y Z
+  *         interleaved words are X, Y and Z vectors. Only 64-bit
+  *         high-half moves and 16-bit unpacks are used, single
+  *         instructions on SSE2 and NEON.
+  *
+  * @param  p     words 0 to 7 in, X out after three rounds(ptr)
+  * @param  q     words 8 to 15 in, Y out after three rounds(ptr)
+  * @param  r     words 16 to 23 in, Z out after three rounds(ptr)
+  *
+  */
+I3G4250D_SOA_INLINE void i3g4250d_soa_round(i3g4250d_v8u16_t *p,
+                                            i3g4250d_v8u16_t *q,
+                                            i3g4250d_v8u16_t *r)
+{
+  i3g4250d_v8u16_t hp;
+  i3g4250d_v8u16_t hq;
+  i3g4250d_v8u16_t hr;
+  i3g4250d_v8u16_t lo;
+
+  hp = __builtin_shufflevector(*p, *p, 4, 5, 6, 7, 4, 5, 6, 7);
+  hq = __builtin_shufflevector(*q, *q, 4, 5, 6, 7, 4, 5, 6, 7);
+  hr = __builtin_shufflevector(*r, *r, 4, 5, 6, 7, 4, 5, 6, 7);
+
+  lo = *q;
+  *p = __builtin_shufflevector(*p, hq, 0, 8, 1, 9, 2, 10, 3, 11);
+  *q = __builtin_shufflevector(hp, *r, 0, 8, 1, 9, 2, 10, 3, 11);
+  *r = __builtin_shufflevector(lo, hr, 0, 8, 1, 9, 2, 10, 3, 11);
+}
+
+/**
+  * @brief  X, Y and Z vectors of 8 samples from their interleaved words.
+  *
+  * @param  p     words 0 to 7 in, X out(ptr)
+  * @param  q     words 8 to 15 in, Y out(ptr)
+  * @param  r     words 16 to 23 in, Z out(ptr)
+  *
+  */
+I3G4250D_SOA_INLINE void i3g4250d_soa_lanes(i3g4250d_v8u16_t *p,
+                                            i3g4250d_v8u16_t *q,
+                                            i3g4250d_v8u16_t *r)
+{
+  i3g4250d_soa_round(p, q, r);
+  i3g4250d_soa_round(p, q, r);
+  i3g4250d_soa_round(p, q, r);
+}
+
+/**
+  * @brief  Deinterleave in place a block holding the X Y Z words of
+  *         I3G4250D_FIFO_DEPTH samples, as read from the device, into
+  *         its X, Y and Z lanes. The whole block is held in twelve
+  *         128-bit registers (every index is a constant, so the array
+  *         is not kept in memory) and stored back once deinterleaved.
+  *
+  * @param  val   block, device byte order in, host byte order out(ptr)
+  * @param  swap  0: device byte order is the host one; 1: swap bytes
+  *
+  */
+static void i3g4250d_soa_deinterleave(i3g4250d_fifo_soa_t *val, uint8_t swap)
+{
+  uint8_t *blk = (uint8_t *)val;
+  i3g4250d_v8u16_t v[12];
+
+  v[0] = i3g4250d_soa_load(&blk[0], swap);
+  v[1] = i3g4250d_soa_load(&blk[16], swap);
+  v[2] = i3g4250d_soa_load(&blk[32], swap);
+  v[3] = i3g4250d_soa_load(&blk[48], swap);
+  v[4] = i3g4250d_soa_load(&blk[64], swap);
+  v[5] = i3g4250d_soa_load(&blk[80], swap);
+  v[6] = i3g4250d_soa_load(&blk[96], swap);
+  v[7] = i3g4250d_soa_load(&blk[112], swap);
+  v[8] = i3g4250d_soa_load(&blk[128], swap);
+  v[9] = i3g4250d_soa_load(&blk[144], swap);
+  v[10] = i3g4250d_soa_load(&blk[160], swap);
+  v[11] = i3g4250d_soa_load(&blk[176], swap);
+
+  i3g4250d_soa_lanes(&v[0], &v[1], &v[2]);
+  i3g4250d_soa_lanes(&v[3], &v[4], &v[5]);
+  i3g4250d_soa_lanes(&v[6], &v[7], &v[8]);
+  i3g4250d_soa_lanes(&v[9], &v[10], &v[11]);
+
+  (void)memcpy(&val->x[0], &v[0], sizeof(v[0]));
+  (void)memcpy(&val->x[8], &v[3], sizeof(v[0]));
+  (void)memcpy(&val->x[16], &v[6], sizeof(v[0]));
+  (void)memcpy(&val->x[24], &v[9], sizeof(v[0]));
+  (void)memcpy(&val->y[0], &v[1], sizeof(v[0]));
+  (void)memcpy(&val->y[8], &v[4], sizeof(v[0]));
+  (void)memcpy(&val->y[16], &v[7], sizeof(v[0]));
+  (void)memcpy(&val->y[24], &v[10], sizeof(v[0]));
+  (void)memcpy(&val->z[0], &v[2], sizeof(v[0]));
+  (void)memcpy(&val->z[8], &v[5], sizeof(v[0]));
+  (void)memcpy(&val->z[16], &v[8], sizeof(v[0]));
+  (void)memcpy(&val->z[24], &v[11], sizeof(v[0]));
+}
+
+#else
+
+/**
+  * @brief  Deinterleave in place a block holding the X Y Z words of
+  *         "num" samples, as read from the device, into its X, Y and Z
+  *         lanes (scalar version, through a copy of the words read).
+  *
+  * @param  val   block, device byte order in, host byte order out(ptr)
+  * @param  num   number of samples in the block
+  * @param  swap  0: device byte order is the host one; 1: swap bytes
+  *
+  */
+static void i3g4250d_soa_deinterleave_scalar(i3g4250d_fifo_soa_t *val,
+                                             uint8_t num, uint8_t swap)
+{
+  int16_t buf[I3G4250D_FIFO_DEPTH * 3U];
+  uint8_t n;
+
+  (void)memcpy(buf, val, (uint32_t)num * 6U);
+  if (swap != 0U)
+  {
+    i3g4250d_swap16(buf, (uint16_t)num * 3U);
+  }
+
+  for (n = 0U; n < num; n++)
+  {
+    val->x[n] = buf[3U * n];
+    val->y[n] = buf[(3U * n) + 1U];
+    val->z[n] = buf[(3U * n) + 2U];
+  }
+}
+#endif /* I3G4250D_SOA_SIMD */
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup    I3G4250D_Sensitivity
+  * @brief       These functions convert raw-data into engineering units.
+  * @{
+  *
+  */
+
+float_t i3g4250d_from_fs245dps_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb * 8.75f);
+}
+
+float_t i3g4250d_from_fs500dps_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb * 17.50f);
+}
+
+float_t i3g4250d_from_fs2000dps_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb * 70.0f);
+}
+
+float_t i3g4250d_from_lsb_to_celsius(int16_t lsb)
+{
+  return ((float_t)lsb + 25.0f);
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_data_generation
+  * @brief      This section groups all the functions concerning
+  *             data generation
+  * @{
+  *
+  */
+
+/**
+  * @brief  Accelerometer data rate selection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of dr in reg CTRL_REG1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_data_rate_set(const stmdev_ctx_t *ctx, i3g4250d_dr_t val)
+{
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG1);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
+                          (uint8_t *)&ctrl_reg1, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg1.dr = ((uint8_t)val & 0x30U) >> 4;
+    ctrl_reg1.pd = ((uint8_t)val & 0x0FU);
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG1,
+                             (uint8_t *)&ctrl_reg1, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG1);
+
+  return ret;
+}
+
+/**
+  * @brief  Accelerometer data rate selection.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of dr in reg CTRL_REG1.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_data_rate_get(const stmdev_ctx_t *ctx, i3g4250d_dr_t *val)
+{
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
+                          (uint8_t *)&ctrl_reg1, 1);
+  if (ret != 0) { return ret; }
+
+  switch ((ctrl_reg1.dr  << 4) + ctrl_reg1.pd)
+  {
+    case 0x00:
+      *val = I3G4250D_ODR_OFF;
+      break;
+
+    case 0x08:
+      *val = I3G4250D_ODR_SLEEP;
+      break;
+
+    case 0x0F:
+      *val = I3G4250D_ODR_100Hz;
+      break;
+
+    case 0x1F:
+      *val = I3G4250D_ODR_200Hz;
+      break;
+
+    case 0x2F:
+      *val = I3G4250D_ODR_400Hz;
+      break;
+
+    case 0x3F:
+      *val = I3G4250D_ODR_800Hz;
+      break;
+
+    default:
+      *val = I3G4250D_ODR_OFF;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Output data rate of the current configuration, in Hz.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Output data rate [Hz], 0 in power-down or sleep
+  *                mode.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_data_rate_hz_get(const stmdev_ctx_t *ctx, float_t *val)
+{
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
+                          (uint8_t *)&ctrl_reg1, 1);
+  if (ret != 0) { return ret; }
+
+  *val = i3g4250d_odr_hz(ctrl_reg1);
+
+  return ret;
+}
+
+/**
+  * @brief  Gyroscope full-scale selection.[set]
+  *
+  * @param  ctx    read / write interface definitions(ptr)
+  * @param  val    change the values of fs in reg CTRL_REG4
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_full_scale_set(const stmdev_ctx_t *ctx, i3g4250d_fs_t val)
+{
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG4);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
+                          (uint8_t *)&ctrl_reg4, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg4.fs = (uint8_t)val & 0x03U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
+                             (uint8_t *)&ctrl_reg4, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG4);
+
+  return ret;
+}
+
+/**
+  * @brief  Gyroscope full-scale selection.[get]
+  *
+  * @param  ctx    read / write interface definitions(ptr)
+  * @param  val    Get the values of fs in reg CTRL_REG4
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_full_scale_get(const stmdev_ctx_t *ctx, i3g4250d_fs_t *val)
+{
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
+                          (uint8_t *)&ctrl_reg4, 1);
+  if (ret != 0) { return ret; }
+
+  switch (ctrl_reg4.fs)
+  {
+    case 0x00:
+      *val = I3G4250D_245dps;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_500dps;
+      break;
+
+    case 0x02:
+      *val = I3G4250D_2000dps;
+      break;
+
+    default:
+      *val = I3G4250D_245dps;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  The STATUS_REG register is read by the primary interface.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    registers STATUS_REG
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_status_reg_get(const stmdev_ctx_t *ctx,
+                                i3g4250d_status_reg_t *val)
+{
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_STATUS_REG, (uint8_t *) val, 1);
+
+  return ret;
+}
+
+/**
+  * @brief  Accelerometer new data available.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of "zyxda" in reg STATUS_REG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_flag_data_ready_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  i3g4250d_status_reg_t status_reg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_STATUS_REG,
+                          (uint8_t *)&status_reg, 1);
+  if (ret != 0) { return ret; }
+
+  *val = status_reg.zyxda;
+
+  return ret;
+}
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_Dataoutput
+  * @brief      This section groups all the data output functions.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Temperature data.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  buff   Buffer that stores the data read.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_temperature_raw_get(const stmdev_ctx_t *ctx, uint8_t *buff)
+{
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_OUT_TEMP, buff, 1);
+
+  return ret;
+}
+
+/**
+  * @brief  Angular rate sensor. The value is expressed as a 16-bit word in
+  *         two's complement.[get]
+  *         Data are decoded following the byte order selected with
+  *         i3g4250d_data_format_set (cached in the driver private data).
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Buffer that stores the data read (X, Y, Z).(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_angular_rate_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
+{
+  int32_t ret;
+
+  ret =  i3g4250d_read_reg(ctx, I3G4250D_OUT_X_L, (uint8_t *)val, 6);
+  if (ret != 0) { return ret; }
+
+  i3g4250d_raw_to_host(ctx, val, 3U);
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_common
+  * @brief      This section groups common useful functions.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Device Who amI.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  buff   Buffer that stores the data read.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_device_id_get(const stmdev_ctx_t *ctx, uint8_t *buff)
+{
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_WHO_AM_I, buff, 1);
+
+  return ret;
+}
+
+/**
+  * @brief  Angular rate sensor self-test enable. [set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    change the values of st in reg CTRL_REG4.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_self_test_set(const stmdev_ctx_t *ctx, i3g4250d_st_t val)
+{
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG4);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
+                          (uint8_t *)&ctrl_reg4, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg4.st = (uint8_t)val & 0x03U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
+                             (uint8_t *)&ctrl_reg4, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG4);
+
+  return ret;
+}
+
+/**
+  * @brief  Angular rate sensor self-test enable. [get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of st in reg CTRL_REG4.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_self_test_get(const stmdev_ctx_t *ctx, i3g4250d_st_t *val)
+{
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
+                          (uint8_t *)&ctrl_reg4, 1);
+  if (ret != 0) { return ret; }
+
+  switch (ctrl_reg4.st)
+  {
+    case 0x00:
+      *val = I3G4250D_GY_ST_DISABLE;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_GY_ST_POSITIVE;
+      break;
+
+    case 0x03:
+      *val = I3G4250D_GY_ST_NEGATIVE;
+      break;
+
+    default:
+      *val = I3G4250D_GY_ST_DISABLE;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Big/Little Endian data selection.[set]
+  *         The new setting is cached in the driver private data.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of "ble" in reg CTRL_REG4.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_data_format_set(const stmdev_ctx_t *ctx,
+                                 i3g4250d_ble_t val)
+{
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG4);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
+                          (uint8_t *)&ctrl_reg4, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg4.ble = (uint8_t)val & 0x01U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
+                             (uint8_t *)&ctrl_reg4, 1);
+  }
+
+  if ((ret == 0) && (ctx->priv_data != NULL))
+  {
+    I3G4250D_SEQ_STORE(&((i3g4250d_priv_t *)ctx->priv_data)->ble,
+                       (uint8_t)ctrl_reg4.ble);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG4);
+
+  return ret;
+}
+
+/**
+  * @brief  Big/Little Endian data selection.[get]
+  *         The value read refreshes the driver private data.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of "ble" in reg CTRL_REG4.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_data_format_get(const stmdev_ctx_t *ctx,
+                                 i3g4250d_ble_t *val)
+{
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
+                          (uint8_t *)&ctrl_reg4, 1);
+  if (ret != 0) { return ret; }
+
+  if (ctx->priv_data != NULL)
+  {
+    I3G4250D_SEQ_STORE(&((i3g4250d_priv_t *)ctx->priv_data)->ble,
+                       (uint8_t)ctrl_reg4.ble);
+  }
+
+  switch (ctrl_reg4.ble)
+  {
+    case 0x00:
+      *val = I3G4250D_AUX_LSB_AT_LOW_ADD;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_AUX_MSB_AT_LOW_ADD;
+      break;
+
+    default:
+      *val = I3G4250D_AUX_LSB_AT_LOW_ADD;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reboot memory content. Reload the calibration parameters.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of boot in reg CTRL_REG5.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_boot_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG5);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
+                          (uint8_t *)&ctrl_reg5, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg5.boot = val & 0x01U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG5,
+                             (uint8_t *)&ctrl_reg5, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG5);
+
+  return ret;
+}
+
+/**
+  * @brief  Reboot memory content. Reload the calibration parameters.[get]
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  val     Get the values of boot in reg CTRL_REG5.(ptr)
+  * @retval         interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_boot_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
+                          (uint8_t *)&ctrl_reg5, 1);
+  if (ret != 0) { return ret; }
+
+  *val = ctrl_reg5.boot;
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_filters
+  * @brief      This section group all the functions concerning the
+  *             filters configuration.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Lowpass filter bandwidth selection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of "bw" in reg CTRL_REG1.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_lp_bandwidth_set(const stmdev_ctx_t *ctx,
+                                  i3g4250d_bw_t val)
+{
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG1);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
+                          (uint8_t *)&ctrl_reg1, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg1.bw = (uint8_t)val & 0x03U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG1,
+                             (uint8_t *)&ctrl_reg1, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG1);
+
+  return ret;
+}
+
+/**
+  * @brief  Lowpass filter bandwidth selection.[get]
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  val     Get the values of "bw" in reg CTRL_REG1.(ptr)
+  * @retval         Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_lp_bandwidth_get(const stmdev_ctx_t *ctx,
+                                  i3g4250d_bw_t *val)
+{
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1,
+                          (uint8_t *)&ctrl_reg1, 1);
+  if (ret != 0) { return ret; }
+
+  switch (ctrl_reg1.bw)
+  {
+    case 0x00:
+      *val = I3G4250D_CUT_OFF_LOW;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_CUT_OFF_MEDIUM;
+      break;
+
+    case 0x02:
+      *val = I3G4250D_CUT_OFF_HIGH;
+      break;
+
+    case 0x03:
+      *val = I3G4250D_CUT_OFF_VERY_HIGH;
+      break;
+
+    default:
+      *val = I3G4250D_CUT_OFF_LOW;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  High-pass filter bandwidth selection.[set]
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  val     Change the values of "hpcf" in reg CTRL_REG2.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_hp_bandwidth_set(const stmdev_ctx_t *ctx,
+                                  i3g4250d_hpcf_t val)
+{
+  i3g4250d_ctrl_reg2_t ctrl_reg2;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG2);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG2,
+                          (uint8_t *)&ctrl_reg2, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg2.hpcf = (uint8_t)val & 0x0FU;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG2,
+                             (uint8_t *)&ctrl_reg2, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG2);
+
+  return ret;
+}
+
+/**
+  * @brief  High-pass filter bandwidth selection.[get]
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  val     Get the values of hpcf in reg CTRL_REG2.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_hp_bandwidth_get(const stmdev_ctx_t *ctx,
+                                  i3g4250d_hpcf_t *val)
+{
+  i3g4250d_ctrl_reg2_t ctrl_reg2;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG2,
+                          (uint8_t *)&ctrl_reg2, 1);
+  if (ret != 0) { return ret; }
+
+  switch (ctrl_reg2.hpcf)
+  {
+    case 0x00:
+      *val = I3G4250D_HP_LEVEL_0;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_HP_LEVEL_1;
+      break;
+
+    case 0x02:
+      *val = I3G4250D_HP_LEVEL_2;
+      break;
+
+    case 0x03:
+      *val = I3G4250D_HP_LEVEL_3;
+      break;
+
+    case 0x04:
+      *val = I3G4250D_HP_LEVEL_4;
+      break;
+
+    case 0x05:
+      *val = I3G4250D_HP_LEVEL_5;
+      break;
+
+    case 0x06:
+      *val = I3G4250D_HP_LEVEL_6;
+      break;
+
+    case 0x07:
+      *val = I3G4250D_HP_LEVEL_7;
+      break;
+
+    case 0x08:
+      *val = I3G4250D_HP_LEVEL_8;
+      break;
+
+    case 0x09:
+      *val = I3G4250D_HP_LEVEL_9;
+      break;
+
+    default:
+      *val = I3G4250D_HP_LEVEL_0;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  High-pass filter mode selection. [set]
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  val     Change the values of "hpm" in reg CTRL_REG2.
+  * @retval         Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_hp_mode_set(const stmdev_ctx_t *ctx, i3g4250d_hpm_t val)
+{
+  i3g4250d_ctrl_reg2_t ctrl_reg2;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG2);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG2,
+                          (uint8_t *)&ctrl_reg2, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg2.hpm = (uint8_t)val & 0x03U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG2,
+                             (uint8_t *)&ctrl_reg2, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG2);
+
+  return ret;
+}
+
+/**
+  * @brief  High-pass filter mode selection. [get]
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  val     Get the values of hpm in reg CTRL_REG2.(ptr)
+  * @retval         Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_hp_mode_get(const stmdev_ctx_t *ctx, i3g4250d_hpm_t *val)
+{
+  i3g4250d_ctrl_reg2_t ctrl_reg2;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG2,
+                          (uint8_t *)&ctrl_reg2, 1);
+  if (ret != 0) { return ret; }
+
+  switch (ctrl_reg2.hpm)
+  {
+    case 0x00:
+      *val = I3G4250D_HP_NORMAL_MODE_WITH_RST;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_HP_REFERENCE_SIGNAL;
+      break;
+
+    case 0x02:
+      *val = I3G4250D_HP_NORMAL_MODE;
+      break;
+
+    case 0x03:
+      *val = I3G4250D_HP_AUTO_RESET_ON_INT;
+      break;
+
+    default:
+      *val = I3G4250D_HP_NORMAL_MODE_WITH_RST;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Out/FIFO selection path. [set]
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  val     Change the values of "out_sel" in reg CTRL_REG5.
+  * @retval         Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_filter_path_set(const stmdev_ctx_t *ctx,
+                                 i3g4250d_out_sel_t val)
+{
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG5);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
+                          (uint8_t *)&ctrl_reg5, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg5.out_sel = (uint8_t)val & 0x03U;
+    ctrl_reg5.hpen = ((uint8_t)val & 0x04U) >> 2;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG5,
+                             (uint8_t *)&ctrl_reg5, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG5);
+
+  return ret;
+}
+
+/**
+  * @brief  Out/FIFO selection path. [get]
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  val     Get the values of out_sel in reg CTRL_REG5.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_filter_path_get(const stmdev_ctx_t *ctx,
+                                 i3g4250d_out_sel_t *val)
+{
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
+                          (uint8_t *)&ctrl_reg5, 1);
+  if (ret != 0) { return ret; }
+
+  switch ((ctrl_reg5.hpen << 2) + ctrl_reg5.out_sel)
+  {
+    case 0x00:
+      *val = I3G4250D_ONLY_LPF1_ON_OUT;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_LPF1_HP_ON_OUT;
+      break;
+
+    case 0x02:
+      *val = I3G4250D_LPF1_LPF2_ON_OUT;
+      break;
+
+    case 0x06:
+      *val = I3G4250D_LPF1_HP_LPF2_ON_OUT;
+      break;
+
+    default:
+      *val = I3G4250D_ONLY_LPF1_ON_OUT;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt generator selection path.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of int1_sel in reg CTRL_REG5
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_filter_path_internal_set(const stmdev_ctx_t *ctx,
+                                          i3g4250d_int1_sel_t val)
+{
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG5);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
+                          (uint8_t *)&ctrl_reg5, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg5.int1_sel = (uint8_t)val & 0x03U;
+    ctrl_reg5.hpen = ((uint8_t)val & 0x04U) >> 2;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG5,
+                             (uint8_t *)&ctrl_reg5, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG5);
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt generator selection path.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of int1_sel in reg CTRL_REG5.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_filter_path_internal_get(const stmdev_ctx_t *ctx,
+                                          i3g4250d_int1_sel_t *val)
+{
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
+                          (uint8_t *)&ctrl_reg5, 1);
+  if (ret != 0) { return ret; }
+
+  switch ((ctrl_reg5.hpen << 2) + ctrl_reg5.int1_sel)
+  {
+    case 0x00:
+      *val = I3G4250D_ONLY_LPF1_ON_INT;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_LPF1_HP_ON_INT;
+      break;
+
+    case 0x02:
+      *val = I3G4250D_LPF1_LPF2_ON_INT;
+      break;
+
+    case 0x06:
+      *val = I3G4250D_LPF1_HP_LPF2_ON_INT;
+      break;
+
+    default:
+      *val = I3G4250D_ONLY_LPF1_ON_INT;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reference value for high-pass filter.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of ref in reg REFERENCE
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_hp_reference_value_set(const stmdev_ctx_t *ctx,
+                                        uint8_t val)
+{
+  i3g4250d_reference_t reference;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_REFERENCE);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_REFERENCE,
+                          (uint8_t *)&reference, 1);
+
+  if (ret == 0)
+  {
+    reference.ref = val;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_REFERENCE,
+                             (uint8_t *)&reference, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_REFERENCE);
+
+  return ret;
+}
+
+/**
+  * @brief  Reference value for high-pass filter.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of ref in reg REFERENCE.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_hp_reference_value_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val)
+{
+  i3g4250d_reference_t reference;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_REFERENCE,
+                          (uint8_t *)&reference, 1);
+  if (ret != 0) { return ret; }
+
+  *val = reference.ref;
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_serial_interface
+  * @brief   This section groups all the functions concerning main serial
+  *          interface management.
+  * @{
+  *
+  */
+
+/**
+  * @brief  SPI Serial Interface Mode selection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of sim in reg CTRL_REG4
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_spi_mode_set(const stmdev_ctx_t *ctx, i3g4250d_sim_t val)
+{
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG4);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
+                          (uint8_t *)&ctrl_reg4, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg4.sim = (uint8_t)val & 0x01U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
+                             (uint8_t *)&ctrl_reg4, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG4);
+
+  return ret;
+}
+
+/**
+  * @brief  SPI Serial Interface Mode selection.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of sim in reg CTRL_REG4.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_spi_mode_get(const stmdev_ctx_t *ctx, i3g4250d_sim_t *val)
+{
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG4,
+                          (uint8_t *)&ctrl_reg4, 1);
+  if (ret != 0) { return ret; }
+
+  switch (ctrl_reg4.sim)
+  {
+    case 0x00:
+      *val = I3G4250D_SPI_4_WIRE;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_SPI_3_WIRE;
+      break;
+
+    default:
+      *val = I3G4250D_SPI_4_WIRE;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Bus the device is connected to. When declared, the driver
+  *         sets the multi-byte auto-increment bit of the sub-address
+  *         itself on every transaction longer than one byte.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Bus type, stored in the driver private data
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_bus_mode_set(const stmdev_ctx_t *ctx, i3g4250d_bus_t val)
+{
+  if ((ctx == NULL) || (ctx->priv_data == NULL)) { return -1; }
+
+  ((i3g4250d_priv_t *)ctx->priv_data)->bus = (uint8_t)val;
+
+  return 0;
+}
+
+/**
+  * @brief  Bus the device is connected to.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Bus type, read from the driver private data.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_bus_mode_get(const stmdev_ctx_t *ctx, i3g4250d_bus_t *val)
+{
+  const i3g4250d_priv_t *priv;
+
+  if ((ctx == NULL) || (ctx->priv_data == NULL)) { return -1; }
+
+  priv = (const i3g4250d_priv_t *)ctx->priv_data;
+
+  switch (priv->bus)
+  {
+    case 0x01:
+      *val = I3G4250D_BUS_I2C;
+      break;
+
+    case 0x02:
+      *val = I3G4250D_BUS_SPI;
+      break;
+
+    default:
+      *val = I3G4250D_BUS_USER;
+      break;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Multi-byte access check. Registers CTRL_REG1 to REFERENCE are
+  *         read in a single burst and one by one: the two readings
+  *         match only if the bus really performs auto-increment.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    1: burst access is working; 0: burst access is broken
+  *                (auto-increment bit not set or not handled).(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_bus_burst_check(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  uint8_t burst[6];
+  uint8_t single;
+  uint8_t i;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1, burst, 6);
+  if (ret != 0) { return ret; }
+
+  *val = PROPERTY_ENABLE;
+
+  for (i = 0U; i < 6U; i++)
+  {
+    ret = i3g4250d_read_reg(ctx, (uint8_t)(I3G4250D_CTRL_REG1 + i),
+                            &single, 1);
+    if (ret != 0) { return ret; }
+
+    if (single != burst[i])
+    {
+      *val = PROPERTY_DISABLE;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Bus retry policy.[set]
+  *         Retry budget is refilled and statistics are cleared.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Retry policy, stored in the driver private data.(ptr)
+  * @retval        0: done; -1: no driver private data
+  *
+  */
+int32_t i3g4250d_bus_retry_set(const stmdev_ctx_t *ctx,
+                               const i3g4250d_bus_retry_t *val)
+{
+  i3g4250d_priv_t *priv;
+
+  if ((ctx == NULL) || (ctx->priv_data == NULL)) { return -1; }
+
+  priv = (i3g4250d_priv_t *)ctx->priv_data;
+  priv->retry = *val;
+  priv->tokens = val->budget;
+  (void)memset(&priv->stats, 0, sizeof(i3g4250d_bus_stats_t));
+
+  return 0;
+}
+
+/**
+  * @brief  Bus retry policy.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Retry policy, read from the driver private data.(ptr)
+  * @retval        0: done; -1: no driver private data
+  *
+  */
+int32_t i3g4250d_bus_retry_get(const stmdev_ctx_t *ctx,
+                               i3g4250d_bus_retry_t *val)
+{
+  if ((ctx == NULL) || (ctx->priv_data == NULL)) { return -1; }
+
+  *val = ((const i3g4250d_priv_t *)ctx->priv_data)->retry;
+
+  return 0;
+}
+
+/**
+  * @brief  Bus error statistics.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Statistics since the last i3g4250d_bus_retry_set.(ptr)
+  * @retval        0: done; -1: no driver private data
+  *
+  */
+int32_t i3g4250d_bus_stats_get(const stmdev_ctx_t *ctx,
+                               i3g4250d_bus_stats_t *val)
+{
+  if ((ctx == NULL) || (ctx->priv_data == NULL)) { return -1; }
+
+  *val = ((const i3g4250d_priv_t *)ctx->priv_data)->stats;
+
+  return 0;
+}
+
+/**
+  * @brief  Locks protecting a context shared by several threads.[set]
+  *         "lock" / "unlock" receive I3G4250D_LOCK_BUS around each bus
+  *         transaction (the same lock can be shared by all the devices
+  *         on a bus), or the register address around each
+  *         read-modify-write sequence of the driver setters. The cached
+  *         registers are read without lock. A register lock is always
+  *         taken before the bus lock, and several register locks in
+  *         increasing address order.
+  *         Must be called before the context is shared.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Lock callbacks, stored in the driver private data.(ptr)
+  * @retval        0: done; -1: no driver private data
+  *
+  */
+int32_t i3g4250d_lock_set(const stmdev_ctx_t *ctx, const i3g4250d_lock_t *val)
+{
+  if ((ctx == NULL) || (ctx->priv_data == NULL)) { return -1; }
+
+  ((i3g4250d_priv_t *)ctx->priv_data)->lock = *val;
+
+  return 0;
+}
+
+/**
+  * @brief  Last value read from or written to one of CTRL_REG1 to
+  *         CTRL_REG5, without bus access. The read is lock-free: it is
+  *         retried while a transaction updates the shadow, and only
+  *         waits for the bus lock if the update doesn't complete within
+  *         I3G4250D_SEQ_RETRY attempts (e.g. a writer preempted by the
+  *         reader on a single core).[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  reg    I3G4250D_CTRL_REG1 to I3G4250D_CTRL_REG5
+  * @param  val    Register content.(ptr)
+  * @retval        0: done; -1: no driver private data, register out of
+  *                range or not accessed yet
+  *
+  */
+int32_t i3g4250d_ctrl_reg_cached_get(const stmdev_ctx_t *ctx, uint8_t reg,
+                                     uint8_t *val)
+{
+  const i3g4250d_priv_t *priv;
+  uint32_t seq;
+  uint8_t attempt;
+  uint8_t valid;
+  uint8_t data;
+  uint8_t idx;
+  uint8_t done = PROPERTY_DISABLE;
+
+  if ((ctx == NULL) || (ctx->priv_data == NULL) ||
+      (reg < I3G4250D_CTRL_REG1) || (reg > I3G4250D_CTRL_REG5))
+  {
+    return -1;
+  }
+
+  priv = (const i3g4250d_priv_t *)ctx->priv_data;
+  idx = (uint8_t)(reg - I3G4250D_CTRL_REG1);
+
+  for (attempt = 0U; (attempt < I3G4250D_SEQ_RETRY) &&
+       (done == PROPERTY_DISABLE); attempt++)
+  {
+    seq = I3G4250D_SEQ_LOAD(&priv->seq);
+    valid = I3G4250D_SEQ_LOAD(&priv->ctrl_valid);
+    data = I3G4250D_SEQ_LOAD(&priv->ctrl_reg[idx]);
+
+    if (((seq & 1U) == 0U) && (I3G4250D_SEQ_LOAD(&priv->seq) == seq))
+    {
+      done = PROPERTY_ENABLE;
+    }
+  }
+
+  if (done == PROPERTY_DISABLE)
+  {
+    /* the writer holds the bus lock for the whole update */
+    i3g4250d_lock(ctx, I3G4250D_LOCK_BUS);
+    valid = I3G4250D_SEQ_LOAD(&priv->ctrl_valid);
+    data = I3G4250D_SEQ_LOAD(&priv->ctrl_reg[idx]);
+    i3g4250d_unlock(ctx, I3G4250D_LOCK_BUS);
+  }
+
+  if ((valid & (1U << idx)) == 0U) { return -1; }
+
+  *val = data;
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_interrupt_pins
+  * @brief      This section groups all the functions that manage interrupt pins
+  * @{
+  *
+  */
+
+
+/**
+  * @brief  Select the signal that need to route on int1 pad.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Configure CTRL_REG3 int1 pad
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_pin_int1_route_set(const stmdev_ctx_t *ctx,
+                                    i3g4250d_int1_route_t val)
+{
+  i3g4250d_ctrl_reg3_t ctrl_reg3;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG3);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
+                          (uint8_t *)&ctrl_reg3, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg3.i1_int1         = val.i1_int1;
+    ctrl_reg3.i1_boot         = val.i1_boot;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG3,
+                             (uint8_t *)&ctrl_reg3, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG3);
+
+  return ret;
+}
+
+/**
+  * @brief  Select the signal that need to route on int1 pad.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Read CTRL_REG3 int1 pad.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+
+int32_t i3g4250d_pin_int1_route_get(const stmdev_ctx_t *ctx,
+                                    i3g4250d_int1_route_t *val)
+{
+  i3g4250d_ctrl_reg3_t ctrl_reg3;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
+                          (uint8_t *)&ctrl_reg3, 1);
+  if (ret != 0) { return ret; }
+
+  val->i1_int1       = ctrl_reg3.i1_int1;
+  val->i1_boot       = ctrl_reg3.i1_boot;
+
+  return ret;
+}
+/**
+  * @brief  Select the signal that need to route on int2 pad.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Configure CTRL_REG3 int2 pad
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_pin_int2_route_set(const stmdev_ctx_t *ctx,
+                                    i3g4250d_int2_route_t val)
+{
+  i3g4250d_ctrl_reg3_t ctrl_reg3;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG3);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
+                          (uint8_t *)&ctrl_reg3, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg3.i2_empty         = val.i2_empty;
+    ctrl_reg3.i2_orun          = val.i2_orun;
+    ctrl_reg3.i2_wtm           = val.i2_wtm;
+    ctrl_reg3.i2_drdy          = val.i2_drdy;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG3,
+                             (uint8_t *)&ctrl_reg3, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG3);
+
+  return ret;
+}
+
+/**
+  * @brief  Select the signal that need to route on int2 pad.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Read CTRL_REG3 int2 pad.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_pin_int2_route_get(const stmdev_ctx_t *ctx,
+                                    i3g4250d_int2_route_t *val)
+{
+  i3g4250d_ctrl_reg3_t ctrl_reg3;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
+                          (uint8_t *)&ctrl_reg3, 1);
+  if (ret != 0) { return ret; }
+
+  val->i2_empty       = ctrl_reg3.i2_empty;
+  val->i2_orun        = ctrl_reg3.i2_orun;
+  val->i2_wtm         = ctrl_reg3.i2_wtm;
+  val->i2_drdy        = ctrl_reg3.i2_drdy;
+
+  return ret;
+}
+/**
+  * @brief  Push-pull/open drain selection on interrupt pads.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of pp_od in reg CTRL_REG3
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+
+int32_t i3g4250d_pin_mode_set(const stmdev_ctx_t *ctx, i3g4250d_pp_od_t val)
+{
+  i3g4250d_ctrl_reg3_t ctrl_reg3;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG3);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
+                          (uint8_t *)&ctrl_reg3, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg3.pp_od = (uint8_t)val & 0x01U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG3,
+                             (uint8_t *)&ctrl_reg3, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG3);
+
+  return ret;
+}
+
+/**
+  * @brief  Push-pull/open drain selection on interrupt pads.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of pp_od in reg CTRL_REG3.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_pin_mode_get(const stmdev_ctx_t *ctx,
+                              i3g4250d_pp_od_t *val)
+{
+  i3g4250d_ctrl_reg3_t ctrl_reg3;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
+                          (uint8_t *)&ctrl_reg3, 1);
+  if (ret != 0) { return ret; }
+
+  switch (ctrl_reg3.pp_od)
+  {
+    case 0x00:
+      *val = I3G4250D_PUSH_PULL;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_OPEN_DRAIN;
+      break;
+
+    default:
+      *val = I3G4250D_PUSH_PULL;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Pin active-high/low.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of h_lactive in reg CTRL_REG3.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_pin_polarity_set(const stmdev_ctx_t *ctx,
+                                  i3g4250d_h_lactive_t val)
+{
+  i3g4250d_ctrl_reg3_t ctrl_reg3;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG3);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
+                          (uint8_t *)&ctrl_reg3, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg3.h_lactive = (uint8_t)val & 0x01U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG3,
+                             (uint8_t *)&ctrl_reg3, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG3);
+
+  return ret;
+}
+
+/**
+  * @brief  Pin active-high/low.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of h_lactive in reg CTRL_REG3.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_pin_polarity_get(const stmdev_ctx_t *ctx,
+                                  i3g4250d_h_lactive_t *val)
+{
+  i3g4250d_ctrl_reg3_t ctrl_reg3;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG3,
+                          (uint8_t *)&ctrl_reg3, 1);
+  if (ret != 0) { return ret; }
+
+  switch (ctrl_reg3.h_lactive)
+  {
+    case 0x00:
+      *val = I3G4250D_ACTIVE_HIGH;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_ACTIVE_LOW;
+      break;
+
+    default:
+      *val = I3G4250D_ACTIVE_HIGH;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Latched/pulsed interrupt.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of lir in reg INT1_CFG.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_notification_set(const stmdev_ctx_t *ctx,
+                                      i3g4250d_lir_t val)
+{
+  i3g4250d_int1_cfg_t int1_cfg;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_INT1_CFG);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
+
+  if (ret == 0)
+  {
+    int1_cfg.lir = (uint8_t)val & 0x01U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_INT1_CFG);
+
+  return ret;
+}
+
+/**
+  * @brief  Latched/pulsed interrupt.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of lir in reg INT1_CFG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_notification_get(const stmdev_ctx_t *ctx,
+                                      i3g4250d_lir_t *val)
+{
+  i3g4250d_int1_cfg_t int1_cfg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
+  if (ret != 0) { return ret; }
+
+  switch (int1_cfg.lir)
+  {
+    case 0x00:
+      *val = I3G4250D_INT_PULSED;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_INT_LATCHED;
+      break;
+
+    default:
+      *val = I3G4250D_INT_PULSED;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_ interrupt_on_threshold
+  * @brief      This section groups all the functions that manage the event
+  *             generation on threshold.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Configure the interrupt threshold sign.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Struct of registers INT1_CFG
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_on_threshold_conf_set(const stmdev_ctx_t *ctx,
+                                           i3g4250d_int1_cfg_t *val)
+{
+  int32_t ret;
+
+  ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *) val, 1);
+
+  return ret;
+}
+
+/**
+  * @brief  Configure the interrupt threshold sign.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Struct of registers from INT1_CFG to.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_on_threshold_conf_get(const stmdev_ctx_t *ctx,
+                                           i3g4250d_int1_cfg_t *val)
+{
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *) val, 1);
+
+  return ret;
+}
+/**
+  * @brief  AND/OR combination of interrupt events.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of and_or in reg INT1_CFG
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_on_threshold_mode_set(const stmdev_ctx_t *ctx,
+                                           i3g4250d_and_or_t val)
+{
+  i3g4250d_int1_cfg_t int1_cfg;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_INT1_CFG);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
+
+  if (ret == 0)
+  {
+    int1_cfg.and_or = (uint8_t)val & 0x01U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_INT1_CFG);
+
+  return ret;
+}
+
+/**
+  * @brief  AND/OR combination of interrupt events.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of and_or in reg INT1_CFG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_on_threshold_mode_get(const stmdev_ctx_t *ctx,
+                                           i3g4250d_and_or_t *val)
+{
+  i3g4250d_int1_cfg_t int1_cfg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&int1_cfg, 1);
+  if (ret != 0) { return ret; }
+
+  switch (int1_cfg.and_or)
+  {
+    case 0x00:
+      *val = I3G4250D_INT1_ON_TH_OR;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_INT1_ON_TH_AND;
+      break;
+
+    default:
+      *val = I3G4250D_INT1_ON_TH_OR;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief   int_on_threshold_src: [get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Union of registers from INT1_SRC to.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_on_threshold_src_get(const stmdev_ctx_t *ctx,
+                                          i3g4250d_int1_src_t *val)
+{
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_SRC, (uint8_t *) val, 1);
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt threshold on X.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of thsx in reg INT1_TSH_XH
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_x_threshold_set(const stmdev_ctx_t *ctx, uint16_t val)
+{
+  i3g4250d_int1_tsh_xh_t int1_tsh_xh;
+  i3g4250d_int1_tsh_xl_t int1_tsh_xl;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_INT1_TSH_XH);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XH,
+                          (uint8_t *)&int1_tsh_xh, 1);
+
+  if (ret == 0)
+  {
+    int1_tsh_xh.thsx = (uint8_t)(val / 256U) & 0x7FU;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_XH,
+                             (uint8_t *)&int1_tsh_xh, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XL,
+                            (uint8_t *)&int1_tsh_xl, 1);
+  }
+
+  if (ret == 0)
+  {
+    int1_tsh_xl.thsx = (uint8_t)(val - (int1_tsh_xh.thsx * 256U));
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_XL,
+                             (uint8_t *)&int1_tsh_xl, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_INT1_TSH_XH);
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt threshold on X.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of thsx in reg INT1_TSH_XH.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_x_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val)
+{
+  i3g4250d_int1_tsh_xh_t int1_tsh_xh;
+  i3g4250d_int1_tsh_xl_t int1_tsh_xl;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XH,
+                          (uint8_t *)&int1_tsh_xh, 1);
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XL,
+                            (uint8_t *)&int1_tsh_xl, 1);
+    if (ret != 0) { return ret; }
+
+    *val = int1_tsh_xh.thsx;
+    *val = *val * 256U;
+    *val +=  int1_tsh_xl.thsx;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt threshold on Y.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of thsy in reg INT1_TSH_YH
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_y_threshold_set(const stmdev_ctx_t *ctx, uint16_t val)
+{
+  i3g4250d_int1_tsh_yh_t int1_tsh_yh;
+  i3g4250d_int1_tsh_yl_t int1_tsh_yl;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_INT1_TSH_YH);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_YH,
+                          (uint8_t *)&int1_tsh_yh, 1);
+  int1_tsh_yh.thsy = (uint8_t)(val / 256U) & 0x7FU;
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_YH,
+                             (uint8_t *)&int1_tsh_yh, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_YL,
+                            (uint8_t *)&int1_tsh_yl, 1);
+    int1_tsh_yl.thsy = (uint8_t)(val - (int1_tsh_yh.thsy * 256U));
+  }
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_YL,
+                             (uint8_t *)&int1_tsh_yl, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_INT1_TSH_YH);
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt threshold on Y.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of thsy in reg INT1_TSH_YH.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_y_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val)
+{
+  i3g4250d_int1_tsh_yh_t int1_tsh_yh;
+  i3g4250d_int1_tsh_yl_t int1_tsh_yl;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_YH,
+                          (uint8_t *)&int1_tsh_yh, 1);
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_YL,
+                            (uint8_t *)&int1_tsh_yl, 1);
+    if (ret != 0) { return ret; }
+
+    *val = int1_tsh_yh.thsy;
+    *val = *val * 256U;
+    *val += int1_tsh_yl.thsy;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt threshold on Z.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of thsz in reg INT1_TSH_ZH.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_z_threshold_set(const stmdev_ctx_t *ctx, uint16_t val)
+{
+  i3g4250d_int1_tsh_zh_t int1_tsh_zh;
+  i3g4250d_int1_tsh_zl_t int1_tsh_zl;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_INT1_TSH_ZH);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_ZH,
+                          (uint8_t *)&int1_tsh_zh, 1);
+  int1_tsh_zh.thsz = (uint8_t)(val / 256U) & 0x7FU;;
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_ZH,
+                             (uint8_t *)&int1_tsh_zh, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_ZL,
+                            (uint8_t *)&int1_tsh_zl, 1);
+    int1_tsh_zl.thsz = (uint8_t)(val - (int1_tsh_zh.thsz * 256U));
+  }
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_ZL,
+                             (uint8_t *)&int1_tsh_zl, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_INT1_TSH_ZH);
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt threshold on Z.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of thsz in reg INT1_TSH_ZH.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_z_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val)
+{
+  i3g4250d_int1_tsh_zh_t int1_tsh_zh;
+  i3g4250d_int1_tsh_zl_t int1_tsh_zl;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_ZH,
+                          (uint8_t *)&int1_tsh_zh, 1);
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_ZL,
+                            (uint8_t *)&int1_tsh_zl, 1);
+    if (ret != 0) { return ret; }
+
+    *val = int1_tsh_zh.thsz;
+    *val = *val * 256U;
+    *val += int1_tsh_zl.thsz;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Durationvalue.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of d in reg INT1_DURATION
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_on_threshold_dur_set(const stmdev_ctx_t *ctx,
+                                          uint8_t val)
+{
+  i3g4250d_int1_duration_t int1_duration;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_INT1_DURATION);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_DURATION,
+                          (uint8_t *)&int1_duration, 1);
+
+  if (ret == 0)
+  {
+    int1_duration.d = val & 0x7FU;
+
+    if (val != PROPERTY_DISABLE)
+    {
+      int1_duration.wait = PROPERTY_ENABLE;
+    }
+
+    else
+    {
+      int1_duration.wait = PROPERTY_DISABLE;
+    }
+
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_DURATION,
+                             (uint8_t *)&int1_duration, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_INT1_DURATION);
+
+  return ret;
+}
+
+/**
+  * @brief  Durationvalue.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of d in reg INT1_DURATION.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_on_threshold_dur_get(const stmdev_ctx_t *ctx,
+                                          uint8_t *val)
+{
+  i3g4250d_int1_duration_t int1_duration;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_DURATION,
+                          (uint8_t *)&int1_duration, 1);
+  if (ret != 0) { return ret; }
+
+  *val = int1_duration.d;
+
+  return ret;
+}
+
+/**
+  * @brief  Threshold event configuration in physical units.[set]
+  *         Thresholds [dps] and duration [ms] are converted with the
+  *         full scale and data rate currently set in the device, then
+  *         INT1_CFG and INT1_TSH_XH to INT1_DURATION are programmed in
+  *         two bursts, holding the locks of all these registers.
+  *         Values out of range are saturated. The WAIT bit of
+  *         INT1_DURATION is set as requested by "wait".
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Event configuration.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *                -1 also when a duration is requested with the device
+  *                powered down or in sleep mode
+  *
+  */
+int32_t i3g4250d_int_on_threshold_phys_set(const stmdev_ctx_t *ctx,
+                                           const i3g4250d_int1_phys_t *val)
+{
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  uint8_t ctrl[4];
+  uint8_t tsh[7];
+  uint8_t cfg;
+  float_t dps[3];
+  float_t sens;
+  float_t odr;
+  float_t raw;
+  uint16_t ths;
+  uint8_t i;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1, ctrl, 4);
+  if (ret != 0) { return ret; }
+
+  (void)memcpy(&ctrl_reg1, &ctrl[0], 1);
+  (void)memcpy(&ctrl_reg4, &ctrl[3], 1);
+  sens = i3g4250d_sensitivity_mdps(ctrl_reg4.fs);
+  odr = i3g4250d_odr_hz(ctrl_reg1);
+
+  if ((val->duration_ms > 0.0f) && (odr == 0.0f)) { return -1; }
+
+  dps[0] = val->x_dps;
+  dps[1] = val->y_dps;
+  dps[2] = val->z_dps;
+
+  for (i = 0U; i < 3U; i++)
+  {
+    raw = ((dps[i] * 1000.0f) / sens) + 0.5f;
+    ths = (raw <= 0.0f) ? 0U :
+          ((raw >= 32767.0f) ? 0x7FFFU : (uint16_t)raw);
+    tsh[2U * i] = (uint8_t)(ths / 256U) & 0x7FU;
+    tsh[(2U * i) + 1U] = (uint8_t)(ths & 0xFFU);
+  }
+
+  raw = ((val->duration_ms * odr) / 1000.0f) + 0.5f;
+  tsh[6] = (raw <= 0.0f) ? 0U : ((raw >= 127.0f) ? 0x7FU : (uint8_t)raw);
+  if (val->wait != PROPERTY_DISABLE)
+  {
+    tsh[6] |= 0x80U;
+  }
+
+  (void)memcpy(&cfg, &val->cfg, 1);
+
+  i3g4250d_lock(ctx, I3G4250D_INT1_CFG);
+  i3g4250d_lock(ctx, I3G4250D_INT1_TSH_XH);
+  i3g4250d_lock(ctx, I3G4250D_INT1_TSH_YH);
+  i3g4250d_lock(ctx, I3G4250D_INT1_TSH_ZH);
+  i3g4250d_lock(ctx, I3G4250D_INT1_DURATION);
+
+  ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_CFG, &cfg, 1);
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_write_reg(ctx, I3G4250D_INT1_TSH_XH, tsh, 7);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_INT1_DURATION);
+  i3g4250d_unlock(ctx, I3G4250D_INT1_TSH_ZH);
+  i3g4250d_unlock(ctx, I3G4250D_INT1_TSH_YH);
+  i3g4250d_unlock(ctx, I3G4250D_INT1_TSH_XH);
+  i3g4250d_unlock(ctx, I3G4250D_INT1_CFG);
+
+  return ret;
+}
+
+/**
+  * @brief  Threshold event configuration in physical units.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Event configuration.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_int_on_threshold_phys_get(const stmdev_ctx_t *ctx,
+                                           i3g4250d_int1_phys_t *val)
+{
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  uint8_t ctrl[4];
+  uint8_t tsh[7];
+  float_t sens;
+  float_t odr;
+  float_t dps[3];
+  uint8_t i;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1, ctrl, 4);
+  if (ret != 0) { return ret; }
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_CFG, (uint8_t *)&val->cfg, 1);
+  if (ret != 0) { return ret; }
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_INT1_TSH_XH, tsh, 7);
+  if (ret != 0) { return ret; }
+
+  (void)memcpy(&ctrl_reg1, &ctrl[0], 1);
+  (void)memcpy(&ctrl_reg4, &ctrl[3], 1);
+  sens = i3g4250d_sensitivity_mdps(ctrl_reg4.fs);
+  odr = i3g4250d_odr_hz(ctrl_reg1);
+
+  for (i = 0U; i < 3U; i++)
+  {
+    dps[i] = (float_t)((((uint16_t)tsh[2U * i] & 0x7FU) * 256U) +
+                       tsh[(2U * i) + 1U]) * sens / 1000.0f;
+  }
+
+  val->x_dps = dps[0];
+  val->y_dps = dps[1];
+  val->z_dps = dps[2];
+  val->duration_ms = (odr == 0.0f) ? 0.0f :
+                     ((float_t)(tsh[6] & 0x7FU) * 1000.0f) / odr;
+  val->wait = ((tsh[6] & 0x80U) != 0U) ? PROPERTY_ENABLE : PROPERTY_DISABLE;
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_fifo
+  * @brief   This section group all the functions concerning the fifo usage
+  * @{
+  *
+  */
+
+/**
+  * @brief  FIFOenable.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fifo_en in reg CTRL_REG5
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_enable_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG5);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
+                          (uint8_t *)&ctrl_reg5, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg5.fifo_en = val & 0x01U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG5,
+                             (uint8_t *)&ctrl_reg5, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG5);
+
+  return ret;
+}
+
+/**
+  * @brief  FIFOenable.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fifo_en in reg CTRL_REG5.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_enable_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG5,
+                          (uint8_t *)&ctrl_reg5, 1);
+  if (ret != 0) { return ret; }
+
+  *val = ctrl_reg5.fifo_en;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO watermark level selection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of wtm in reg FIFO_CTRL_REG
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_watermark_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  i3g4250d_fifo_ctrl_reg_t fifo_ctrl_reg;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_FIFO_CTRL_REG);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG,
+                          (uint8_t *)&fifo_ctrl_reg, 1);
+
+  if (ret == 0)
+  {
+    fifo_ctrl_reg.wtm = val & 0x1FU;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_FIFO_CTRL_REG,
+                             (uint8_t *)&fifo_ctrl_reg, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_FIFO_CTRL_REG);
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO watermark level selection.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of wtm in reg FIFO_CTRL_REG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_watermark_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  i3g4250d_fifo_ctrl_reg_t fifo_ctrl_reg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG,
+                          (uint8_t *)&fifo_ctrl_reg, 1);
+  if (ret != 0) { return ret; }
+
+  *val = fifo_ctrl_reg.wtm;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO mode selection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fm in reg FIFO_CTRL_REG
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_mode_set(const stmdev_ctx_t *ctx,
+                               i3g4250d_fifo_mode_t val)
+{
+  i3g4250d_fifo_ctrl_reg_t fifo_ctrl_reg;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_FIFO_CTRL_REG);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG,
+                          (uint8_t *)&fifo_ctrl_reg, 1);
+
+  if (ret == 0)
+  {
+    fifo_ctrl_reg.fm = (uint8_t)val & 0x07U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_FIFO_CTRL_REG,
+                             (uint8_t *)&fifo_ctrl_reg, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_FIFO_CTRL_REG);
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO mode selection.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fm in reg FIFO_CTRL_REG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_mode_get(const stmdev_ctx_t *ctx,
+                               i3g4250d_fifo_mode_t *val)
+{
+  i3g4250d_fifo_ctrl_reg_t fifo_ctrl_reg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG,
+                          (uint8_t *)&fifo_ctrl_reg, 1);
+  if (ret != 0) { return ret; }
+
+  switch (fifo_ctrl_reg.fm)
+  {
+    case 0x00:
+      *val = I3G4250D_FIFO_BYPASS_MODE;
+      break;
+
+    case 0x01:
+      *val = I3G4250D_FIFO_MODE;
+      break;
+
+    case 0x02:
+      *val = I3G4250D_FIFO_STREAM_MODE;
+      break;
+
+    default:
+      *val = I3G4250D_FIFO_BYPASS_MODE;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO stored data level[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fss in reg FIFO_SRC_REG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_data_level_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                          (uint8_t *)&fifo_src_reg, 1);
+  if (ret != 0) { return ret; }
+
+  *val = fifo_src_reg.fss;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFOemptybit.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of empty in reg FIFO_SRC_REG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_empty_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                          (uint8_t *)&fifo_src_reg, 1);
+  if (ret != 0) { return ret; }
+
+  *val = fifo_src_reg.empty;
+
+  return ret;
+}
+
+/**
+  * @brief  Overrun bit status.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of ovrn in reg FIFO_SRC_REG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_ovr_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                          (uint8_t *)&fifo_src_reg, 1);
+  if (ret != 0) { return ret; }
+
+  *val = fifo_src_reg.ovrn;
+
+  return ret;
+}
+
+/**
+  * @brief  Watermark status:[get]
+  *                0: FIFO filling is lower than WTM level;
+  *                1: FIFO filling is equal or higher than WTM level)
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of wtm in reg FIFO_SRC_REG.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+
+int32_t i3g4250d_fifo_wtm_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                          (uint8_t *)&fifo_src_reg, 1);
+  if (ret != 0) { return ret; }
+
+  *val = fifo_src_reg.wtm;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO angular rate samples.[get]
+  *         The samples are read in a single burst straight into the
+  *         caller buffer (e.g. a DMA buffer) which is then exposed in
+  *         place as X, Y, Z words: when FIFO is enabled the register
+  *         address rolls back from OUT_Z_H to OUT_X_L on multiple read.
+  *         A decode pass is done only if the byte order selected with
+  *         i3g4250d_data_format_set differs from the host one.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Buffer of (num * 3) words, X Y Z interleaved.(ptr)
+  * @param  num    Number of samples to read (1 to I3G4250D_FIFO_DEPTH)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_angular_rate_raw_get(const stmdev_ctx_t *ctx,
+                                           int16_t *val, uint8_t num)
+{
+  int32_t ret;
+
+  if ((num == 0U) || (num > I3G4250D_FIFO_DEPTH)) { return -1; }
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_OUT_X_L, (uint8_t *)val,
+                          (uint16_t)num * 6U);
+  if (ret != 0) { return ret; }
+
+  i3g4250d_raw_to_host(ctx, val, (uint16_t)num * 3U);
+
+  return ret;
+}
+
+/**
+  * @brief  Number of samples to drain, from FIFO_SRC_REG.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  max    Buffer size in samples
+  * @param  val    Samples stored in FIFO, up to max.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+static int32_t i3g4250d_fifo_level_get(const stmdev_ctx_t *ctx, uint8_t max,
+                                       uint8_t *val)
+{
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                          (uint8_t *)&fifo_src_reg, 1);
+  if (ret != 0) { return ret; }
+
+  *val = i3g4250d_fifo_level(&fifo_src_reg);
+  *val = (*val < max) ? *val : max;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO drain: FIFO_SRC_REG is read, then the stored samples
+  *         (up to "max") are read in a single burst. Meant to be called
+  *         on the watermark interrupt, e.g. from an event loop.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Buffer of (max * 3) words, X Y Z interleaved.(ptr)
+  * @param  max    Buffer size in samples (1 to I3G4250D_FIFO_DEPTH)
+  * @param  num    Number of samples read.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_drain(const stmdev_ctx_t *ctx, int16_t *val,
+                            uint8_t max, uint8_t *num)
+{
+  uint8_t level;
+  int32_t ret;
+
+  *num = 0U;
+
+  if ((max == 0U) || (max > I3G4250D_FIFO_DEPTH)) { return -1; }
+
+  ret = i3g4250d_fifo_level_get(ctx, max, &level);
+  if ((ret != 0) || (level == 0U)) { return ret; }
+
+  ret = i3g4250d_fifo_angular_rate_raw_get(ctx, val, level);
+  if (ret == 0)
+  {
+    *num = level;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO angular rate samples, in separate X, Y, Z lanes.[get]
+  *         The samples are read in a single burst straight into the
+  *         block (e.g. a DMA buffer), then deinterleaved in place into
+  *         its lanes, fused with the byte order decode: with compiler
+  *         vector extensions (I3G4250D_SOA_SIMD) in registers, without
+  *         any other buffer. Lane words past "num" are unspecified.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Block receiving the samples, aligned to
+  *                I3G4250D_SOA_ALIGN.(ptr)
+  * @param  num    Number of samples to read (1 to I3G4250D_FIFO_DEPTH)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_angular_rate_raw_soa_get(const stmdev_ctx_t *ctx,
+                                               i3g4250d_fifo_soa_t *val,
+                                               uint8_t num)
+{
+  uint8_t swap;
+  int32_t ret;
+
+  if ((num == 0U) || (num > I3G4250D_FIFO_DEPTH)) { return -1; }
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_OUT_X_L, (uint8_t *)val,
+                          (uint16_t)num * 6U);
+  if (ret != 0) { return ret; }
+
+  swap = (i3g4250d_ble_cached(ctx) != (uint8_t)I3G4250D_HOST_BLE) ?
+         (uint8_t)1U : (uint8_t)0U;
+
+#if (I3G4250D_SOA_SIMD != 0)
+  i3g4250d_soa_deinterleave(val, swap);
+#else
+  i3g4250d_soa_deinterleave_scalar(val, num, swap);
+#endif /* I3G4250D_SOA_SIMD */
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO drain into separate X, Y, Z lanes: FIFO_SRC_REG is
+  *         read, then the stored samples (up to "max") are read in a
+  *         single burst.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Block receiving the samples, aligned to
+  *                I3G4250D_SOA_ALIGN.(ptr)
+  * @param  max    Samples to drain at most (1 to I3G4250D_FIFO_DEPTH)
+  * @param  num    Number of samples read.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_fifo_drain_soa(const stmdev_ctx_t *ctx,
+                                i3g4250d_fifo_soa_t *val, uint8_t max,
+                                uint8_t *num)
+{
+  uint8_t level;
+  int32_t ret;
+
+  *num = 0U;
+
+  if ((max == 0U) || (max > I3G4250D_FIFO_DEPTH)) { return -1; }
+
+  ret = i3g4250d_fifo_level_get(ctx, max, &level);
+  if ((ret != 0) || (level == 0U)) { return ret; }
+
+  ret = i3g4250d_fifo_angular_rate_raw_soa_get(ctx, val, level);
+  if (ret == 0)
+  {
+    *num = level;
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_odr_governor
+  * @brief      This section groups the functions that adapt the output
+  *             data rate to the signal activity. The activity measure is
+  *             the rms of the sample-to-sample differences of each
+  *             drained block, which is insensitive to the zero-rate
+  *             offset.
+  * @{
+  *
+  */
+
+static const i3g4250d_dr_t i3g4250d_gov_odr[5] =
+{
+  I3G4250D_ODR_800Hz, I3G4250D_ODR_400Hz, I3G4250D_ODR_200Hz,
+  I3G4250D_ODR_100Hz, I3G4250D_ODR_SLEEP,
+};
+
+static const uint32_t i3g4250d_gov_period_us[5] =
+{
+  1250U, 2500U, 5000U, 10000U, 0U,
+};
+
+/**
+  * @brief  Switch the data rate with a read-modify-write of CTRL_REG1
+  *         under its register lock, so that the bandwidth and the axes
+  *         set by the application are kept (sleep mode disables the
+  *         axes, they are restored on the next switch). Samples still
+  *         in FIFO were acquired at the previous rate and are
+  *         remembered for timestamping.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  gov    Governor instance.(ptr)
+  * @param  level  New rate index in i3g4250d_gov_odr
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+static int32_t i3g4250d_odr_governor_switch(const stmdev_ctx_t *ctx,
+                                            i3g4250d_odr_gov_t *gov,
+                                            uint8_t level)
+{
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  uint8_t odr = (uint8_t)i3g4250d_gov_odr[level];
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG1);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                          (uint8_t *)&fifo_src_reg, 1);
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_ctrl_reg_current(ctx, I3G4250D_CTRL_REG1,
+                                    (uint8_t *)&ctrl_reg1);
+  }
+
+  if (ret == 0)
+  {
+    if (((ctrl_reg1.pd & 0x08U) != 0U) && ((ctrl_reg1.pd & 0x07U) != 0U))
+    {
+      gov->axes = ctrl_reg1.pd & 0x07U;
+    }
+
+    ctrl_reg1.dr = (odr & 0x30U) >> 4;
+    ctrl_reg1.pd = ((uint8_t)(odr & 0x08U) |
+                    (((odr & 0x07U) != 0U) ? gov->axes : 0U)) & 0x0FU;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG1,
+                             (uint8_t *)&ctrl_reg1, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG1);
+
+  if (ret == 0)
+  {
+    gov->pending = i3g4250d_fifo_level(&fifo_src_reg);
+    gov->pending_period_us = i3g4250d_gov_period_us[gov->level];
+    gov->level = level;
+    gov->quiet = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  ODR governor initialization. The device is set to 800 Hz,
+  *         keeping the bandwidth and the axes currently configured.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  gov    Governor instance.(ptr)
+  * @param  cfg    Thresholds and lowest allowed rate.(ptr)
+  * @param  ts_us  Timestamp of the first sample [us]
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_odr_governor_init(const stmdev_ctx_t *ctx,
+                                   i3g4250d_odr_gov_t *gov,
+                                   const i3g4250d_odr_gov_cfg_t *cfg,
+                                   uint64_t ts_us)
+{
+  int32_t ret;
+
+  (void)memset(gov, 0, sizeof(i3g4250d_odr_gov_t));
+  gov->cfg = *cfg;
+  gov->ts_us = ts_us;
+  gov->axes = 0x07U;
+
+  switch (cfg->min_odr)
+  {
+    case I3G4250D_ODR_400Hz:
+      gov->min_level = 1U;
+      break;
+
+    case I3G4250D_ODR_200Hz:
+      gov->min_level = 2U;
+      break;
+
+    case I3G4250D_ODR_SLEEP:
+      gov->min_level = 4U;
+      break;
+
+    case I3G4250D_ODR_800Hz:
+      gov->min_level = 0U;
+      break;
+
+    default:
+      gov->min_level = 3U;
+      break;
+  }
+
+  ret = i3g4250d_odr_governor_switch(ctx, gov, 0U);
+  gov->pending = 0U;
+
+  return ret;
+}
+
+/**
+  * @brief  ODR governor update, to be called on each drained block.
+  *         The block is timestamped at the rate it was acquired at,
+  *         then the rate is stepped: any block above "up_rms" selects
+  *         800 Hz, "hold" consecutive blocks below "down_rms" step the
+  *         rate down by one.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  gov    Governor instance.(ptr)
+  * @param  val    Raw samples, X Y Z interleaved.(ptr)
+  * @param  num    Number of samples
+  * @param  seq    Sequence number of the first sample of the block.(ptr)
+  * @param  ts_us  Timestamp of each sample [us], can be NULL.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_odr_governor_update(const stmdev_ctx_t *ctx,
+                                     i3g4250d_odr_gov_t *gov,
+                                     const int16_t *val, uint16_t num,
+                                     uint32_t *seq, uint64_t *ts_us)
+{
+  uint64_t energy = 0U;
+  int32_t diff;
+  float_t ms;
+  uint16_t n;
+  uint8_t a;
+  int32_t ret = 0;
+
+  *seq = gov->seq;
+  if (num == 0U) { return ret; }
+
+  for (n = 0U; n < num; n++)
+  {
+    if (ts_us != NULL)
+    {
+      ts_us[n] = gov->ts_us;
+    }
+
+    if (gov->pending > 0U)
+    {
+      gov->pending--;
+      gov->ts_us += gov->pending_period_us;
+    }
+
+    else
+    {
+      gov->ts_us += i3g4250d_gov_period_us[gov->level];
+    }
+
+    for (a = 0U; a < 3U; a++)
+    {
+      diff = (int32_t)val[(3U * n) + a] - gov->last[a];
+      energy += (uint64_t)((int64_t)diff * diff);
+      gov->last[a] = val[(3U * n) + a];
+    }
+  }
+
+  gov->seq += num;
+
+  if (gov->primed == PROPERTY_DISABLE)
+  {
+    /* first block: no previous sample to differentiate against */
+    gov->primed = PROPERTY_ENABLE;
+    return ret;
+  }
+
+  /* mean square against the squared thresholds: no square root */
+  ms = (float_t)energy / (float_t)num;
+
+  if (ms > (gov->cfg.up_rms * gov->cfg.up_rms))
+  {
+    gov->quiet = 0U;
+    if (gov->level != 0U)
+    {
+      ret = i3g4250d_odr_governor_switch(ctx, gov, 0U);
+    }
+  }
+
+  else if (ms < (gov->cfg.down_rms * gov->cfg.down_rms))
+  {
+    gov->quiet++;
+    if ((gov->quiet >= gov->cfg.hold) && (gov->level < gov->min_level))
+    {
+      ret = i3g4250d_odr_governor_switch(ctx, gov,
+                                           (uint8_t)(gov->level + 1U));
+    }
+  }
+
+  else
+  {
+    gov->quiet = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Leave the sleep rate (e.g. on an external wake-up event) and
+  *         restart at 800 Hz.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  gov    Governor instance.(ptr)
+  * @param  ts_us  Timestamp of the first sample after wake-up [us]
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_odr_governor_wakeup(const stmdev_ctx_t *ctx,
+                                     i3g4250d_odr_gov_t *gov,
+                                     uint64_t ts_us)
+{
+  int32_t ret;
+
+  ret = i3g4250d_odr_governor_switch(ctx, gov, 0U);
+  if (ret != 0) { return ret; }
+
+  gov->pending = 0U;
+  gov->primed = PROPERTY_DISABLE;
+  gov->ts_us = ts_us;
+
+  return ret;
+}
+
+/**
+  * @brief  Data rate currently selected by the governor.[get]
+  *
+  * @param  gov    Governor instance.(ptr)
+  * @retval        Output data rate
+  *
+  */
+i3g4250d_dr_t i3g4250d_odr_governor_rate_get(const i3g4250d_odr_gov_t *gov)
+{
+  return i3g4250d_gov_odr[gov->level];
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_event_capture
+  * @brief      This section groups the functions that capture a snapshot
+  *             around a threshold event using FIFO mode. While armed the
+  *             FIFO is drained into a host-side pre-trigger ring; once
+  *             the INT1 event is seen draining stops, the FIFO fills up
+  *             at full ODR and freezes, then its content is retrieved in
+  *             a single burst.
+  *             The threshold event should be latched (see
+  *             i3g4250d_int_notification_set) so that it can be polled.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Event capture initialization.
+  *
+  * @param  cap     Capture instance.(ptr)
+  * @param  ring    Pre-trigger ring buffer of (pre_len * 3) words.(ptr)
+  * @param  pre_len Number of pre-trigger samples kept
+  *
+  */
+void i3g4250d_capture_init(i3g4250d_capture_t *cap, int16_t *ring,
+                           uint16_t pre_len)
+{
+  (void)memset(cap, 0, sizeof(i3g4250d_capture_t));
+  cap->ring = ring;
+  cap->pre_len = pre_len;
+}
+
+/**
+  * @brief  Arm the capture: the FIFO is reset through bypass mode and
+  *         restarted in FIFO mode, the pre-trigger ring is emptied.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  cap    Capture instance.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_capture_arm(const stmdev_ctx_t *ctx, i3g4250d_capture_t *cap)
+{
+  i3g4250d_int1_src_t int1_src;
+  int32_t ret;
+
+  ret = i3g4250d_fifo_enable_set(ctx, PROPERTY_ENABLE);
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_fifo_mode_set(ctx, I3G4250D_FIFO_BYPASS_MODE);
+  }
+
+  if (ret == 0)
+  {
+    /* clear a pending latched event */
+    ret = i3g4250d_int_on_threshold_src_get(ctx, &int1_src);
+  }
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_fifo_mode_set(ctx, I3G4250D_FIFO_MODE);
+  }
+
+  if (ret == 0)
+  {
+    cap->head = 0U;
+    cap->count = 0U;
+    cap->state = (uint8_t)I3G4250D_CAPTURE_ARMED;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Store samples in the pre-trigger ring, overwriting the
+  *         oldest ones.
+  *
+  * @param  cap    Capture instance.(ptr)
+  * @param  val    Raw samples, X Y Z interleaved.(ptr)
+  * @param  num    Number of samples
+  *
+  */
+static void i3g4250d_capture_push(i3g4250d_capture_t *cap,
+                                  const int16_t *val, uint16_t num)
+{
+  uint16_t n;
+
+  if (cap->pre_len == 0U) { return; }
+
+  for (n = 0U; n < num; n++)
+  {
+    (void)memcpy(&cap->ring[3U * cap->head], &val[3U * n],
+                 3U * sizeof(int16_t));
+
+    cap->head++;
+    if (cap->head == cap->pre_len)
+    {
+      cap->head = 0U;
+    }
+
+    if (cap->count < cap->pre_len)
+    {
+      cap->count++;
+    }
+  }
+}
+
+/**
+  * @brief  Capture state machine, to be called periodically (or on the
+  *         INT1 / INT2 interrupts) after i3g4250d_capture_arm, at least
+  *         once every I3G4250D_FIFO_DEPTH samples while armed. If the
+  *         FIFO is found full while armed, the capture is re-armed and
+  *         cap->overruns is incremented (an event in that window is
+  *         lost).
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  cap    Capture instance.(ptr)
+  * @param  val    Capture state after the call.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_capture_poll(const stmdev_ctx_t *ctx, i3g4250d_capture_t *cap,
+                              i3g4250d_capture_state_t *val)
+{
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  i3g4250d_int1_src_t int1_src;
+  uint8_t level;
+  int32_t ret = 0;
+
+  if (cap->state == (uint8_t)I3G4250D_CAPTURE_ARMED)
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                            (uint8_t *)&fifo_src_reg, 1);
+    if (ret != 0) { return ret; }
+
+    level = i3g4250d_fifo_level(&fifo_src_reg);
+
+    if (level == I3G4250D_FIFO_DEPTH)
+    {
+      /*
+       * Polled too slowly: the FIFO froze, the history has a gap and
+       * its content can't be told from post-trigger data. Start over.
+       */
+      cap->overruns++;
+      ret = i3g4250d_capture_arm(ctx, cap);
+      *val = (i3g4250d_capture_state_t)cap->state;
+
+      return ret;
+    }
+
+    ret = i3g4250d_int_on_threshold_src_get(ctx, &int1_src);
+    if (ret != 0) { return ret; }
+
+    if (int1_src.ia == PROPERTY_ENABLE)
+    {
+      cap->state = (uint8_t)I3G4250D_CAPTURE_TRIGGERED;
+    }
+
+    else if (level > 0U)
+    {
+      ret = i3g4250d_fifo_angular_rate_raw_get(ctx, &cap->post[0][0], level);
+      if (ret == 0)
+      {
+        i3g4250d_capture_push(cap, &cap->post[0][0], level);
+      }
+    }
+
+    else
+    {
+      /* nothing to drain */
+    }
+  }
+
+  if ((ret == 0) && (cap->state == (uint8_t)I3G4250D_CAPTURE_TRIGGERED))
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                            (uint8_t *)&fifo_src_reg, 1);
+
+    if ((ret == 0) &&
+        (i3g4250d_fifo_level(&fifo_src_reg) == I3G4250D_FIFO_DEPTH))
+    {
+      ret = i3g4250d_fifo_angular_rate_raw_get(ctx, &cap->post[0][0],
+                                               (uint8_t)I3G4250D_FIFO_DEPTH);
+      if (ret == 0)
+      {
+        cap->state = (uint8_t)I3G4250D_CAPTURE_DONE;
+      }
+    }
+  }
+
+  *val = (i3g4250d_capture_state_t)cap->state;
+
+  return ret;
+}
+
+/**
+  * @brief  Captured snapshot: pre-trigger history followed by the
+  *         I3G4250D_FIFO_DEPTH samples frozen in the FIFO.[get]
+  *
+  * @param  cap     Capture instance, in I3G4250D_CAPTURE_DONE state.(ptr)
+  * @param  val     Output buffer, room for
+  *                 ((pre_len + I3G4250D_FIFO_DEPTH) * 3) words.(ptr)
+  * @param  pre_num Number of pre-trigger samples at the beginning of
+  *                 the output buffer.(ptr)
+  * @retval         0: done; -1: capture not completed
+  *
+  */
+int32_t i3g4250d_capture_get(const i3g4250d_capture_t *cap, int16_t *val,
+                             uint16_t *pre_num)
+{
+  uint16_t first;
+  uint16_t tail;
+
+  if (cap->state != (uint8_t)I3G4250D_CAPTURE_DONE) { return -1; }
+
+  first = (cap->count < cap->pre_len) ? 0U : cap->head;
+  tail = cap->count - first;
+
+  if (cap->count > 0U)
+  {
+    /* oldest part of the ring, then the wrapped part */
+    (void)memcpy(val, &cap->ring[3U * first], 3U * tail * sizeof(int16_t));
+    (void)memcpy(&val[3U * tail], cap->ring, 3U * first * sizeof(int16_t));
+  }
+
+  (void)memcpy(&val[3U * cap->count], cap->post, sizeof(cap->post));
+  *pre_num = cap->count;
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_recording
+  * @brief      This section groups the functions that write and read the
+  *             binary recording format of raw angular rate streams.
+  *             A recording is made of a file header, carrying the device
+  *             configuration (CTRL_REG1 to CTRL_REG5 and FIFO_CTRL_REG),
+  *             followed by blocks: a block header with the timestamp and
+  *             the sequence number of the first sample, then the raw
+  *             X Y Z samples. All the fields are little-endian and each
+  *             block is padded to 8 bytes, so a memory-mapped recording
+  *             can be accessed in place.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Store a little-endian field.
+  *
+  * @param  buf   destination(ptr)
+  * @param  val   value
+  * @param  len   field size in bytes
+  *
+  */
+static void i3g4250d_le_put(uint8_t *buf, uint64_t val, uint8_t len)
+{
+  uint8_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    buf[i] = (uint8_t)(val >> (8U * i));
+  }
+}
+
+/**
+  * @brief  Load a little-endian field.
+  *
+  * @param  buf   source(ptr)
+  * @param  len   field size in bytes
+  * @retval       value
+  *
+  */
+static uint64_t i3g4250d_le_get(const uint8_t *buf, uint8_t len)
+{
+  uint64_t val = 0U;
+  uint8_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    val |= (uint64_t)buf[i] << (8U * i);
+  }
+
+  return val;
+}
+
+/**
+  * @brief  Recording header from the current device configuration.
+  *         CTRL_REG1 to CTRL_REG5 are read in a single burst.[get]
+  *
+  * @param  ctx       Read / write interface definitions.(ptr)
+  * @param  block_len Maximum number of samples per block
+  * @param  val       Recording header.(ptr)
+  * @retval           Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_rec_header_get(const stmdev_ctx_t *ctx, uint16_t block_len,
+                                i3g4250d_rec_header_t *val)
+{
+  int32_t ret;
+
+  (void)memset(val, 0, sizeof(i3g4250d_rec_header_t));
+  val->version = I3G4250D_REC_VERSION;
+  val->block_len = block_len;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1, val->ctrl_reg, 5);
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_CTRL_REG, &val->fifo_ctrl, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Recording writer initialization. The file header is placed
+  *         at the beginning of the writer buffer.
+  *
+  * @param  w       Writer instance.(ptr)
+  * @param  buf     Writer buffer, at least I3G4250D_REC_BLOCK_SIZE of
+  *                 block_len samples.(ptr)
+  * @param  size    Writer buffer size [byte]
+  * @param  flush   Function that stores the buffer content(ptr)
+  * @param  handle  Customizable argument of the flush function(ptr)
+  * @param  hdr     Recording header.(ptr)
+  * @retval         0: done; -1: buffer too small
+  *
+  */
+int32_t i3g4250d_rec_writer_init(i3g4250d_rec_writer_t *w, uint8_t *buf,
+                                 uint32_t size, i3g4250d_rec_flush_t flush,
+                                 void *handle,
+                                 const i3g4250d_rec_header_t *hdr)
+{
+  if ((hdr->block_len == 0U) ||
+      (size < I3G4250D_REC_BLOCK_SIZE(hdr->block_len)) ||
+      (size < I3G4250D_REC_HEADER_SIZE))
+  {
+    return -1;
+  }
+
+  w->buf = buf;
+  w->size = size;
+  w->flush = flush;
+  w->handle = handle;
+  w->block_len = hdr->block_len;
+
+  (void)memset(buf, 0, I3G4250D_REC_HEADER_SIZE);
+  i3g4250d_le_put(&buf[0], I3G4250D_REC_MAGIC, 4U);
+  i3g4250d_le_put(&buf[4], hdr->version, 2U);
+  i3g4250d_le_put(&buf[6], hdr->block_len, 2U);
+  (void)memcpy(&buf[8], hdr->ctrl_reg, 5);
+  buf[13] = hdr->fifo_ctrl;
+  w->used = I3G4250D_REC_HEADER_SIZE;
+
+  return 0;
+}
+
+/**
+  * @brief  Pass the buffered data to the flush function.
+  *
+  * @param  w       Writer instance.(ptr)
+  * @retval         flush function status (0 -> no Error)
+  *
+  */
+int32_t i3g4250d_rec_writer_flush(i3g4250d_rec_writer_t *w)
+{
+  int32_t ret = 0;
+
+  if (w->used > 0U)
+  {
+    ret = w->flush(w->handle, w->buf, w->used);
+    if (ret == 0)
+    {
+      w->used = 0U;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Append a block of samples (e.g. a drained FIFO block). The
+  *         buffer is flushed first when the block doesn't fit in it.
+  *
+  * @param  w       Writer instance.(ptr)
+  * @param  val     Raw samples, X Y Z interleaved.(ptr)
+  * @param  num     Number of samples (up to the header block_len)
+  * @param  seq     Sequence number of the first sample
+  * @param  ts_us   Timestamp of the first sample [us]
+  * @retval         flush function status (0 -> no Error);
+  *                 -1 when num exceeds block_len
+  *
+  */
+int32_t i3g4250d_rec_write(i3g4250d_rec_writer_t *w, const int16_t *val,
+                           uint16_t num, uint32_t seq, uint64_t ts_us)
+{
+  uint32_t size = I3G4250D_REC_BLOCK_SIZE(num);
+  uint8_t *blk;
+  int32_t ret = 0;
+
+  if (num > w->block_len) { return -1; }
+  if (num == 0U) { return ret; }
+
+  if ((w->used + size) > w->size)
+  {
+    ret = i3g4250d_rec_writer_flush(w);
+    if (ret != 0) { return ret; }
+  }
+
+  blk = &w->buf[w->used];
+  (void)memset(blk, 0, size);
+  i3g4250d_le_put(&blk[0], ts_us, 8U);
+  i3g4250d_le_put(&blk[8], seq, 4U);
+  i3g4250d_le_put(&blk[12], num, 2U);
+
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  (void)memcpy(&blk[I3G4250D_REC_BLOCK_HEADER_SIZE], val,
+               (uint32_t)num * 6U);
+#else
+  {
+    uint16_t i;
+
+    for (i = 0U; i < (uint16_t)(num * 3U); i++)
+    {
+      i3g4250d_le_put(&blk[I3G4250D_REC_BLOCK_HEADER_SIZE + (2U * i)],
+                      (uint16_t)val[i], 2U);
+    }
+  }
+#endif /* DRV_BYTE_ORDER */
+
+  w->used += size;
+
+  return ret;
+}
+
+/**
+  * @brief  Recording header parsing.[get]
+  *
+  * @param  data    Recording content (e.g. memory-mapped file).(ptr)
+  * @param  len     Recording size [byte]
+  * @param  val     Recording header.(ptr)
+  * @retval         0: done; -1: not a recording or unsupported version
+  *
+  */
+int32_t i3g4250d_rec_header_parse(const uint8_t *data, uint32_t len,
+                                  i3g4250d_rec_header_t *val)
+{
+  if ((len < I3G4250D_REC_HEADER_SIZE) ||
+      (i3g4250d_le_get(&data[0], 4U) != I3G4250D_REC_MAGIC))
+  {
+    return -1;
+  }
+
+  val->version = (uint16_t)i3g4250d_le_get(&data[4], 2U);
+  val->block_len = (uint16_t)i3g4250d_le_get(&data[6], 2U);
+  (void)memcpy(val->ctrl_reg, &data[8], 5);
+  val->fifo_ctrl = data[13];
+
+  return (val->version == I3G4250D_REC_VERSION) ? 0 : -1;
+}
+
+/**
+  * @brief  Next block of a recording. The samples are not copied: the
+  *         returned pointer refers to the recording content, and the
+  *         words are little-endian (to be swapped on big-endian hosts).
+  *
+  * @param  data    Recording content (8-byte aligned).(ptr)
+  * @param  len     Recording size [byte]
+  * @param  offset  Offset of the block to parse, I3G4250D_REC_HEADER_SIZE
+  *                 for the first one; updated to the following block.(ptr)
+  * @param  blk     Block header.(ptr)
+  * @param  val     Samples of the block, X Y Z interleaved.(ptr)
+  * @retval         0: block available; -1: end of recording or
+  *                 truncated block
+  *
+  */
+int32_t i3g4250d_rec_block_next(const uint8_t *data, uint32_t len,
+                                uint32_t *offset, i3g4250d_rec_block_t *blk,
+                                const int16_t **val)
+{
+  const uint8_t *hdr;
+  uint32_t size;
+
+  if ((*offset + I3G4250D_REC_BLOCK_HEADER_SIZE) > len) { return -1; }
+
+  hdr = &data[*offset];
+  blk->ts_us = i3g4250d_le_get(&hdr[0], 8U);
+  blk->seq = (uint32_t)i3g4250d_le_get(&hdr[8], 4U);
+  blk->num = (uint16_t)i3g4250d_le_get(&hdr[12], 2U);
+
+  size = I3G4250D_REC_BLOCK_SIZE(blk->num);
+  if ((*offset + size) > len) { return -1; }
+
+  *val = (const int16_t *)(const void *)&hdr[I3G4250D_REC_BLOCK_HEADER_SIZE];
+  *offset += size;
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_replay
+  * @brief      This section groups the functions that replay a recording
+  *             through the driver: i3g4250d_replay_read and
+  *             i3g4250d_replay_write are stmdev_read_ptr / stmdev_write_ptr
+  *             implementations (handle: i3g4250d_replay_t) serving the
+  *             output, STATUS_REG and FIFO_SRC_REG registers from the
+  *             recorded stream. The other registers are emulated by a
+  *             shadow register file, initialized from the recording
+  *             header.
+  *             Without clock the stream is served unthrottled (a new
+  *             sample is always ready), otherwise samples become ready
+  *             at their recorded timestamps.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Move a replay cursor to the next sample (to the first one
+  *         when no block has been loaded yet).
+  *
+  * @param  rp    Replay instance.(ptr)
+  * @param  cur   Cursor.(ptr)
+  * @retval       0: sample available; -1: end of recording
+  *
+  */
+static int32_t i3g4250d_replay_step(const i3g4250d_replay_t *rp,
+                                    i3g4250d_replay_cursor_t *cur)
+{
+  int32_t ret = 0;
+
+  if (cur->blk.num > 0U)
+  {
+    cur->idx++;
+  }
+
+  /* skip to the next non-empty block */
+  while ((ret == 0) && (cur->idx >= cur->blk.num))
+  {
+    ret = i3g4250d_rec_block_next(rp->data, rp->len, &cur->offset,
+                                  &cur->blk, &cur->val);
+    cur->idx = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Timestamp of the sample under a replay cursor.
+  *
+  * @param  rp    Replay instance.(ptr)
+  * @param  cur   Cursor.(ptr)
+  * @retval       timestamp [us]
+  *
+  */
+static uint64_t i3g4250d_replay_ts(const i3g4250d_replay_t *rp,
+                                   const i3g4250d_replay_cursor_t *cur)
+{
+  return cur->blk.ts_us + ((uint64_t)cur->idx * rp->period_us);
+}
+
+/**
+  * @brief  Number of samples ready, up to I3G4250D_FIFO_DEPTH.
+  *
+  * @param  rp    Replay instance.(ptr)
+  * @retval       number of samples ready
+  *
+  */
+static uint8_t i3g4250d_replay_ready(i3g4250d_replay_t *rp)
+{
+  i3g4250d_replay_cursor_t cur = rp->cur;
+  uint64_t limit;
+  uint8_t num = 0U;
+
+  if (rp->eof != 0U) { return 0U; }
+
+  if (rp->now_us == NULL) { return (uint8_t)I3G4250D_FIFO_DEPTH; }
+
+  if (rp->started == 0U)
+  {
+    rp->t0_us = rp->now_us();
+    rp->ts0_us = i3g4250d_replay_ts(rp, &cur);
+    rp->started = 1U;
+  }
+
+  limit = rp->ts0_us + (rp->now_us() - rp->t0_us);
+
+  while ((num < I3G4250D_FIFO_DEPTH) &&
+         (i3g4250d_replay_ts(rp, &cur) <= limit))
+  {
+    num++;
+    if (i3g4250d_replay_step(rp, &cur) != 0) { break; }
+  }
+
+  return num;
+}
+
+/**
+  * @brief  Fault injection: every "fault_period" transactions one fails
+  *         without touching the emulated device.
+  *
+  * @param  rp    Replay instance.(ptr)
+  * @retval       1: this transaction fails; 0: otherwise
+  *
+  */
+static uint8_t i3g4250d_replay_fault(i3g4250d_replay_t *rp)
+{
+  if (rp->fault_period == 0U) { return 0U; }
+
+  rp->xfer++;
+  if (rp->xfer < rp->fault_period) { return 0U; }
+
+  rp->xfer = 0U;
+
+  return 1U;
+}
+
+/**
+  * @brief  Replay initialization.
+  *
+  * @param  rp      Replay instance.(ptr)
+  * @param  data    Recording content (8-byte aligned).(ptr)
+  * @param  len     Recording size [byte]
+  * @param  now_us  Clock [us] for real-time replay, NULL for
+  *                 unthrottled replay.(ptr)
+  * @retval         0: done; -1: invalid or empty recording
+  *
+  */
+int32_t i3g4250d_replay_init(i3g4250d_replay_t *rp, const uint8_t *data,
+                             uint32_t len, i3g4250d_replay_clock_t now_us)
+{
+  i3g4250d_rec_header_t hdr;
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  float_t odr;
+
+  if (i3g4250d_rec_header_parse(data, len, &hdr) != 0) { return -1; }
+
+  (void)memset(rp, 0, sizeof(i3g4250d_replay_t));
+  rp->data = data;
+  rp->len = len;
+  rp->now_us = now_us;
+
+  rp->regs[I3G4250D_WHO_AM_I] = I3G4250D_ID;
+  (void)memcpy(&rp->regs[I3G4250D_CTRL_REG1], hdr.ctrl_reg, 5);
+  rp->regs[I3G4250D_FIFO_CTRL_REG] = hdr.fifo_ctrl;
+
+  (void)memcpy(&ctrl_reg1, &hdr.ctrl_reg[0], 1);
+  odr = i3g4250d_odr_hz(ctrl_reg1);
+  rp->period_us = (odr > 0.0f) ? (uint32_t)(1000000.0f / odr) : 0U;
+
+  rp->cur.offset = I3G4250D_REC_HEADER_SIZE;
+
+  return i3g4250d_replay_step(rp, &rp->cur);
+}
+
+/**
+  * @brief  Replay read function (stmdev_read_ptr). Sub-address
+  *         auto-increment and SPI read bits are ignored; multiple reads
+  *         of the output registers roll back from OUT_Z_H to OUT_X_L
+  *         when FIFO is enabled, as on the device.
+  *
+  * @param  handle  Replay instance (i3g4250d_replay_t).(ptr)
+  * @param  reg     Register to read
+  * @param  buf     Buffer that stores the data read.(ptr)
+  * @param  len     Number of consecutive register to read
+  * @retval         0: no Error; -1: injected fault
+  *
+  */
+int32_t i3g4250d_replay_read(void *handle, uint8_t reg, uint8_t *buf,
+                             uint16_t len)
+{
+  i3g4250d_replay_t *rp = (i3g4250d_replay_t *)handle;
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  i3g4250d_ctrl_reg5_t ctrl_reg5;
+  const uint8_t *sample;
+  uint8_t addr = reg & 0x3FU;
+  uint8_t ready;
+  uint8_t byte;
+  uint16_t i;
+
+  if (i3g4250d_replay_fault(rp) != 0U) { return -1; }
+
+  (void)memcpy(&ctrl_reg4, &rp->regs[I3G4250D_CTRL_REG4], 1);
+  (void)memcpy(&ctrl_reg5, &rp->regs[I3G4250D_CTRL_REG5], 1);
+
+  for (i = 0U; i < len; i++)
+  {
+    if ((addr >= I3G4250D_OUT_X_L) && (addr <= I3G4250D_OUT_Z_H))
+    {
+      if ((addr == I3G4250D_OUT_X_L) && (rp->eof == 0U) &&
+          (i3g4250d_replay_ready(rp) > 0U))
+      {
+        sample = (const uint8_t *)(const void *)&rp->cur.val[3U * rp->cur.idx];
+        (void)memcpy(rp->out, sample, 6);
+        rp->seq++;
+        if (i3g4250d_replay_step(rp, &rp->cur) != 0)
+        {
+          rp->eof = 1U;
+        }
+      }
+
+      /* recording is little-endian, swap pairs if BLE is set */
+      byte = (uint8_t)(addr - I3G4250D_OUT_X_L);
+      if (ctrl_reg4.ble == PROPERTY_ENABLE)
+      {
+        byte ^= 0x01U;
+      }
+      buf[i] = rp->out[byte];
+    }
+
+    else if (addr == I3G4250D_STATUS_REG)
+    {
+      ready = i3g4250d_replay_ready(rp);
+      buf[i] = (ready > 0U) ? 0x0FU : 0x00U;
+    }
+
+    else if (addr == I3G4250D_FIFO_SRC_REG)
+    {
+      ready = i3g4250d_replay_ready(rp);
+      if (ready >= I3G4250D_FIFO_DEPTH)
+      {
+        ready = (uint8_t)I3G4250D_FIFO_DEPTH - 1U;
+      }
+      buf[i] = ready;
+      if (ready == 0U)
+      {
+        buf[i] |= 0x20U; /* empty */
+      }
+      if ((ready >= (rp->regs[I3G4250D_FIFO_CTRL_REG] & 0x1FU)) &&
+          (ready > 0U))
+      {
+        buf[i] |= 0x80U; /* watermark */
+      }
+    }
+
+    else
+    {
+      buf[i] = rp->regs[addr];
+    }
+
+    if ((addr == I3G4250D_OUT_Z_H) && (ctrl_reg5.fifo_en == PROPERTY_ENABLE))
+    {
+      addr = I3G4250D_OUT_X_L;
+    }
+
+    else
+    {
+      addr = (uint8_t)(addr + 1U) & 0x3FU;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Replay write function (stmdev_write_ptr). Writes update the
+  *         shadow register file, so that the driver configuration
+  *         functions can be used unchanged.
+  *
+  * @param  handle  Replay instance (i3g4250d_replay_t).(ptr)
+  * @param  reg     Register to write
+  * @param  buf     Data to write.(ptr)
+  * @param  len     Number of consecutive register to write
+  * @retval         0: no Error; -1: injected fault
+  *
+  */
+int32_t i3g4250d_replay_write(void *handle, uint8_t reg, const uint8_t *buf,
+                              uint16_t len)
+{
+  i3g4250d_replay_t *rp = (i3g4250d_replay_t *)handle;
+  uint8_t addr = reg & 0x3FU;
+  uint16_t i;
+
+  if (i3g4250d_replay_fault(rp) != 0U) { return -1; }
+
+  for (i = 0U; i < len; i++)
+  {
+    rp->regs[addr] = buf[i];
+    addr = (uint8_t)(addr + 1U) & 0x3FU;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  End of recording reached.[get]
+  *
+  * @param  rp      Replay instance.(ptr)
+  * @retval         1: all the samples have been served; 0: otherwise
+  *
+  */
+uint8_t i3g4250d_replay_eof_get(const i3g4250d_replay_t *rp)
+{
+  return rp->eof;
+}
+
+/**
+  * @brief  Inject a bus fault every "period" transactions, to exercise
+  *         the retry policy (see i3g4250d_bus_retry_set).
+  *
+  * @param  rp      Replay instance.(ptr)
+  * @param  period  1: every transaction fails; 0: no fault
+  *
+  */
+void i3g4250d_replay_fault_set(i3g4250d_replay_t *rp, uint32_t period)
+{
+  rp->fault_period = period;
+  rp->xfer = 0U;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_autorange
+  * @brief      This section groups the functions that step the full scale
+  *             on the peak of each drained block. Every sample is tagged
+  *             with the full scale it was acquired at, so conversion
+  *             stays correct across a switch, including the samples that
+  *             were already queued in FIFO.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Switch the full scale with a read-modify-write of CTRL_REG4
+  *         under its register lock, so that the data format and the
+  *         self-test set by the application are kept. Samples still in
+  *         FIFO were acquired at the previous full scales: one 2-bit tag
+  *         per sample is queued, oldest first, so that consecutive
+  *         switches keep each sample tagged with its own full scale.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  ar     Autoranger instance.(ptr)
+  * @param  fs     New full scale
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+static int32_t i3g4250d_autorange_switch(const stmdev_ctx_t *ctx,
+                                         i3g4250d_autorange_t *ar,
+                                         uint8_t fs)
+{
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  uint8_t level;
+  uint8_t n;
+  int32_t ret;
+
+  i3g4250d_lock(ctx, I3G4250D_CTRL_REG4);
+  ret = i3g4250d_read_reg(ctx, I3G4250D_FIFO_SRC_REG,
+                          (uint8_t *)&fifo_src_reg, 1);
+
+  if (ret == 0)
+  {
+    ret = i3g4250d_ctrl_reg_current(ctx, I3G4250D_CTRL_REG4,
+                                    (uint8_t *)&ctrl_reg4);
+  }
+
+  if (ret == 0)
+  {
+    ctrl_reg4.fs = fs & 0x03U;
+    ret = i3g4250d_write_reg(ctx, I3G4250D_CTRL_REG4,
+                             (uint8_t *)&ctrl_reg4, 1);
+  }
+
+  i3g4250d_unlock(ctx, I3G4250D_CTRL_REG4);
+  if (ret != 0) { return ret; }
+
+  /* samples pending at an earlier switch keep their own tag, tags
+     beyond the FIFO level were already read out */
+  level = i3g4250d_fifo_level(&fifo_src_reg);
+
+  if (level < 32U)
+  {
+    ar->pending_fs &= (1ULL << (2U * level)) - 1U;
+  }
+
+  for (n = ar->pending; n < level; n++)
+  {
+    ar->pending_fs |= (uint64_t)ar->fs << (2U * n);
+  }
+
+  ar->pending = level;
+  ar->fs = fs;
+  ar->quiet = 0U;
+
+  return ret;
+}
+
+/**
+  * @brief  Autoranger initialization. The initial full scale is set.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  ar     Autoranger instance.(ptr)
+  * @param  cfg    Thresholds.(ptr)
+  * @param  fs     Initial full scale
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_autorange_init(const stmdev_ctx_t *ctx,
+                                i3g4250d_autorange_t *ar,
+                                const i3g4250d_autorange_cfg_t *cfg,
+                                i3g4250d_fs_t fs)
+{
+  int32_t ret;
+
+  (void)memset(ar, 0, sizeof(i3g4250d_autorange_t));
+  ar->cfg = *cfg;
+
+  ret = i3g4250d_autorange_switch(ctx, ar, (uint8_t)fs);
+  ar->pending = 0U;
+  ar->pending_fs = 0U;
+
+  return ret;
+}
+
+/**
+  * @brief  Autoranger update, to be called on each drained block.
+  *         The block is tagged, then the full scale is stepped: any
+  *         sample of the current scale reaching "up_lsb" steps it up,
+  *         "hold" consecutive blocks whose peak would stay below
+  *         "down_lsb" on the next lower scale step it down.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  ar     Autoranger instance.(ptr)
+  * @param  val    Raw samples, X Y Z interleaved.(ptr)
+  * @param  num    Number of samples
+  * @param  fs     Full scale of each sample, can be NULL.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_autorange_update(const stmdev_ctx_t *ctx,
+                                  i3g4250d_autorange_t *ar,
+                                  const int16_t *val, uint16_t num,
+                                  i3g4250d_fs_t *fs)
+{
+  float_t peak = 0.0f;
+  float_t mdps;
+  int32_t raw;
+  uint16_t n;
+  uint8_t tag;
+  uint8_t a;
+  uint8_t clip = PROPERTY_DISABLE;
+  int32_t ret = 0;
+
+  if (num == 0U) { return ret; }
+
+  for (n = 0U; n < num; n++)
+  {
+    if (ar->pending > 0U)
+    {
+      ar->pending--;
+      tag = (uint8_t)(ar->pending_fs & 0x03U);
+      ar->pending_fs >>= 2;
+    }
+
+    else
+    {
+      tag = ar->fs;
+    }
+
+    if (fs != NULL)
+    {
+      fs[n] = (i3g4250d_fs_t)tag;
+    }
+
+    for (a = 0U; a < 3U; a++)
+    {
+      raw = (int32_t)val[(3U * n) + a];
+      raw = (raw < 0) ? -raw : raw;
+
+      if ((tag == ar->fs) && (raw >= (int32_t)ar->cfg.up_lsb))
+      {
+        clip = PROPERTY_ENABLE;
+      }
+
+      mdps = (float_t)raw * i3g4250d_sensitivity_mdps(tag);
+      peak = (mdps > peak) ? mdps : peak;
+    }
+  }
+
+  if (clip == PROPERTY_ENABLE)
+  {
+    if (ar->fs < (uint8_t)I3G4250D_2000dps)
+    {
+      ret = i3g4250d_autorange_switch(ctx, ar, (uint8_t)(ar->fs + 1U));
+    }
+  }
+
+  else if ((ar->fs > (uint8_t)I3G4250D_245dps) &&
+           ((peak / i3g4250d_sensitivity_mdps((uint8_t)(ar->fs - 1U))) <
+            (float_t)ar->cfg.down_lsb))
+  {
+    ar->quiet++;
+    if (ar->quiet >= ar->cfg.hold)
+    {
+      ret = i3g4250d_autorange_switch(ctx, ar, (uint8_t)(ar->fs - 1U));
+    }
+  }
+
+  else
+  {
+    ar->quiet = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Full scale currently selected by the autoranger.[get]
+  *
+  * @param  ar     Autoranger instance.(ptr)
+  * @retval        Full scale
+  *
+  */
+i3g4250d_fs_t i3g4250d_autorange_fs_get(const i3g4250d_autorange_t *ar)
+{
+  return (i3g4250d_fs_t)ar->fs;
+}
+
+/**
+  * @brief  Convert tagged samples to angular rate.
+  *
+  * @param  val    Raw samples, X Y Z interleaved.(ptr)
+  * @param  fs     Full scale of each sample.(ptr)
+  * @param  num    Number of samples
+  * @param  out    Angular rate [mdps], X Y Z interleaved.(ptr)
+  *
+  */
+void i3g4250d_autorange_to_mdps(const int16_t *val, const i3g4250d_fs_t *fs,
+                                uint16_t num, float_t *out)
+{
+  float_t sens;
+  uint16_t n;
+  uint8_t a;
+
+  for (n = 0U; n < num; n++)
+  {
+    sens = i3g4250d_sensitivity_mdps((uint8_t)fs[n]);
+
+    for (a = 0U; a < 3U; a++)
+    {
+      out[(3U * n) + a] = (float_t)val[(3U * n) + a] * sens;
+    }
+  }
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_async
+  * @brief      This section groups the split-phase versions of the
+  *             register access and FIFO drain functions, for platforms
+  *             whose bus transfers complete asynchronously (DMA, event
+  *             loops, coroutine executors). Each operation is started
+  *             with a transfer request on the asynchronous interface and
+  *             reports its status through a completion callback, which
+  *             may also be called from within the request itself.
+  *             The driver private data linked to ctx, if any, is used
+  *             for the sub-address and the byte order; ctx->read_reg and
+  *             ctx->write_reg are not called.
+  *             The simulated transport runs the transfers on a blocking
+  *             interface and delivers the completions later, from
+  *             i3g4250d_async_sim_poll, to exercise these paths in tests.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Asynchronous register read.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  bus    Asynchronous interface.(ptr)
+  * @param  reg    Register to read
+  * @param  data   Buffer that stores the data read, valid at
+  *                completion.(ptr)
+  * @param  len    Number of consecutive register to read
+  * @param  done   Completion callback
+  * @param  arg    Argument of the completion callback.(ptr)
+  * @retval        Request status (MANDATORY: return 0 -> no Error),
+  *                the completion is not called on error
+  *
+  */
+int32_t i3g4250d_read_reg_async(const stmdev_ctx_t *ctx,
+                                const i3g4250d_async_if_t *bus, uint8_t reg,
+                                uint8_t *data, uint16_t len,
+                                i3g4250d_async_done_t done, void *arg)
+{
+  return bus->read(bus->handle, i3g4250d_sub_address(ctx, reg, len),
+                   data, len, done, arg);
+}
+
+/**
+  * @brief  Asynchronous register write.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  bus    Asynchronous interface.(ptr)
+  * @param  reg    Register to write
+  * @param  data   Data to write, to be kept until completion.(ptr)
+  * @param  len    Number of consecutive register to write
+  * @param  done   Completion callback
+  * @param  arg    Argument of the completion callback.(ptr)
+  * @retval        Request status (MANDATORY: return 0 -> no Error),
+  *                the completion is not called on error
+  *
+  * @note   The CTRL_REG1..CTRL_REG5 shadow and the cached byte order are
+  *         not updated: use i3g4250d_modify_reg_async for these
+  *         registers.
+  *
+  */
+int32_t i3g4250d_write_reg_async(const stmdev_ctx_t *ctx,
+                                 const i3g4250d_async_if_t *bus, uint8_t reg,
+                                 uint8_t *data, uint16_t len,
+                                 i3g4250d_async_done_t done, void *arg)
+{
+  return bus->write(bus->handle, i3g4250d_sub_address(ctx, reg, len),
+                    data, len, done, arg);
+}
+
+/**
+  * @brief  Asynchronous FIFO drain, completion of the samples burst.
+  *
+  */
+static void i3g4250d_fifo_drain_data_done(void *arg, int32_t status)
+{
+  i3g4250d_fifo_drain_op_t *op = (i3g4250d_fifo_drain_op_t *)arg;
+
+  if (status == 0)
+  {
+    i3g4250d_raw_to_host(op->ctx, op->val, (uint16_t)op->num * 3U);
+  }
+
+  else
+  {
+    op->num = 0U;
+  }
+
+  op->status = status;
+  op->done(op->arg, status);
+}
+
+/**
+  * @brief  Asynchronous FIFO drain, completion of the FIFO_SRC_REG read:
+  *         the level is decoded and the samples are requested in one
+  *         burst.
+  *
+  */
+static void i3g4250d_fifo_drain_src_done(void *arg, int32_t status)
+{
+  i3g4250d_fifo_drain_op_t *op = (i3g4250d_fifo_drain_op_t *)arg;
+  i3g4250d_fifo_src_reg_t fifo_src_reg;
+  i3g4250d_async_done_t done = op->done;
+  uint8_t level;
+  int32_t ret = status;
+
+  (void)memcpy(&fifo_src_reg, &op->src, 1);
+
+  if (ret == 0)
+  {
+    level = i3g4250d_fifo_level(&fifo_src_reg);
+    op->num = (level < op->max) ? level : op->max;
+
+    if (op->num > 0U)
+    {
+      ret = i3g4250d_read_reg_async(op->ctx, op->bus, I3G4250D_OUT_X_L,
+                                    (uint8_t *)op->val,
+                                    (uint16_t)op->num * 6U,
+                                    i3g4250d_fifo_drain_data_done, op);
+      if (ret == 0) { return; }
+    }
+  }
+
+  if (ret != 0)
+  {
+    op->num = 0U;
+  }
+
+  op->status = ret;
+  done(op->arg, ret);
+}
+
+/**
+  * @brief  Asynchronous FIFO drain: FIFO_SRC_REG is read, then the
+  *         stored samples (up to "max") are read in a single burst, as
+  *         i3g4250d_fifo_angular_rate_raw_get does. At completion
+  *         op->num holds the number of samples read.
+  *
+  * @param  op     Operation state, to be kept until completion.(ptr)
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  bus    Asynchronous interface.(ptr)
+  * @param  val    Buffer of (max * 3) words, X Y Z interleaved.(ptr)
+  * @param  max    Buffer size in samples (1 to I3G4250D_FIFO_DEPTH)
+  * @param  done   Completion callback
+  * @param  arg    Argument of the completion callback.(ptr)
+  * @retval        Request status (MANDATORY: return 0 -> no Error),
+  *                the completion is not called on error
+  *
+  */
+int32_t i3g4250d_fifo_drain_async(i3g4250d_fifo_drain_op_t *op,
+                                  const stmdev_ctx_t *ctx,
+                                  const i3g4250d_async_if_t *bus,
+                                  int16_t *val, uint8_t max,
+                                  i3g4250d_async_done_t done, void *arg)
+{
+  if ((max == 0U) || (max > I3G4250D_FIFO_DEPTH)) { return -1; }
+
+  op->ctx = ctx;
+  op->bus = bus;
+  op->done = done;
+  op->arg = arg;
+  op->val = val;
+  op->max = max;
+  op->num = 0U;
+  op->status = 0;
+
+  return i3g4250d_read_reg_async(ctx, bus, I3G4250D_FIFO_SRC_REG, &op->src, 1,
+                                 i3g4250d_fifo_drain_src_done, op);
+}
+
+/**
+  * @brief  Asynchronous register update, completion of the write: the
+  *         register shadow and the cached byte order are refreshed as
+  *         the blocking setters do.
+  *
+  */
+static void i3g4250d_modify_write_done(void *arg, int32_t status)
+{
+  i3g4250d_modify_op_t *op = (i3g4250d_modify_op_t *)arg;
+  i3g4250d_priv_t *priv = (i3g4250d_priv_t *)op->ctx->priv_data;
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+
+  if ((status == 0) && (priv != NULL))
+  {
+    i3g4250d_lock(op->ctx, I3G4250D_LOCK_BUS);
+    i3g4250d_ctrl_cache(priv, op->reg, &op->data, 1);
+
+    if (op->reg == I3G4250D_CTRL_REG4)
+    {
+      (void)memcpy(&ctrl_reg4, &op->data, 1);
+      I3G4250D_SEQ_STORE(&priv->ble, (uint8_t)ctrl_reg4.ble);
+    }
+
+    i3g4250d_unlock(op->ctx, I3G4250D_LOCK_BUS);
+  }
+
+  op->status = status;
+  op->done(op->arg, status);
+}
+
+/**
+  * @brief  Asynchronous register update, completion of the read: the
+  *         field is merged and the register written back.
+  *
+  */
+static void i3g4250d_modify_read_done(void *arg, int32_t status)
+{
+  i3g4250d_modify_op_t *op = (i3g4250d_modify_op_t *)arg;
+  int32_t ret = status;
+
+  if (ret == 0)
+  {
+    op->data = (uint8_t)((op->data & (uint8_t)~op->mask) |
+                         (op->val & op->mask));
+    ret = i3g4250d_write_reg_async(op->ctx, op->bus, op->reg, &op->data, 1,
+                                   i3g4250d_modify_write_done, op);
+    if (ret == 0) { return; }
+  }
+
+  op->status = ret;
+  op->done(op->arg, ret);
+}
+
+/**
+  * @brief  Asynchronous read-modify-write of a register, the split-phase
+  *         counterpart of the configuration setters: the bits set in
+  *         "mask" are replaced by the ones of "val", e.g. CTRL_REG4 with
+  *         mask 0x30 for the full scale. The register locks are not
+  *         taken, the application serializes the configuration.
+  *
+  * @param  op     Operation state, to be kept until completion.(ptr)
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  bus    Asynchronous interface.(ptr)
+  * @param  reg    Register to update
+  * @param  mask   Bits to update
+  * @param  val    New value of the bits to update
+  * @param  done   Completion callback
+  * @param  arg    Argument of the completion callback.(ptr)
+  * @retval        Request status (MANDATORY: return 0 -> no Error),
+  *                the completion is not called on error
+  *
+  */
+int32_t i3g4250d_modify_reg_async(i3g4250d_modify_op_t *op,
+                                  const stmdev_ctx_t *ctx,
+                                  const i3g4250d_async_if_t *bus, uint8_t reg,
+                                  uint8_t mask, uint8_t val,
+                                  i3g4250d_async_done_t done, void *arg)
+{
+  op->ctx = ctx;
+  op->bus = bus;
+  op->done = done;
+  op->arg = arg;
+  op->status = 0;
+  op->reg = reg;
+  op->mask = mask;
+  op->val = val;
+
+  return i3g4250d_read_reg_async(ctx, bus, reg, &op->data, 1,
+                                 i3g4250d_modify_read_done, op);
+}
+
+/**
+  * @brief  Simulated asynchronous transport initialization. The
+  *         transfers are run on "ctx" (e.g. a replay instance, see
+  *         i3g4250d_replay_read) and "bus" is set up to use them.
+  *
+  * @param  sim    Simulated transport instance.(ptr)
+  * @param  ctx    Blocking interface running the transfers.(ptr)
+  * @param  bus    Asynchronous interface to set up.(ptr)
+  *
+  */
+void i3g4250d_async_sim_init(i3g4250d_async_sim_t *sim,
+                             const stmdev_ctx_t *ctx,
+                             i3g4250d_async_if_t *bus)
+{
+  (void)memset(sim, 0, sizeof(i3g4250d_async_sim_t));
+  sim->ctx = ctx;
+
+  bus->read = i3g4250d_async_sim_read;
+  bus->write = i3g4250d_async_sim_write;
+  bus->handle = sim;
+}
+
+/**
+  * @brief  Simulated transfer: run at once, completion deferred.
+  *
+  */
+static int32_t i3g4250d_async_sim_xfer(i3g4250d_async_sim_t *sim,
+                                       uint8_t reg, uint8_t *buf,
+                                       uint16_t len, uint8_t write,
+                                       i3g4250d_async_done_t done, void *arg)
+{
+  /* a single transfer in flight, as on one DMA channel */
+  if (sim->pending != 0U) { return -1; }
+
+  sim->status = (write == PROPERTY_ENABLE) ?
+                sim->ctx->write_reg(sim->ctx->handle, reg, buf, len) :
+                sim->ctx->read_reg(sim->ctx->handle, reg, buf, len);
+  sim->done = done;
+  sim->arg = arg;
+  sim->pending = 1U;
+
+  return 0;
+}
+
+/**
+  * @brief  Simulated asynchronous read (i3g4250d_async_xfer_ptr).
+  *
+  * @param  handle  Simulated transport (i3g4250d_async_sim_t).(ptr)
+  * @param  reg     Sub-address
+  * @param  buf     Buffer that stores the data read.(ptr)
+  * @param  len     Number of consecutive register to read
+  * @param  done    Completion callback
+  * @param  arg     Argument of the completion callback.(ptr)
+  * @retval         0: request accepted; -1: a transfer is in flight
+  *
+  */
+int32_t i3g4250d_async_sim_read(void *handle, uint8_t reg, uint8_t *buf,
+                                uint16_t len, i3g4250d_async_done_t done,
+                                void *arg)
+{
+  return i3g4250d_async_sim_xfer((i3g4250d_async_sim_t *)handle, reg, buf,
+                                 len, PROPERTY_DISABLE, done, arg);
+}
+
+/**
+  * @brief  Simulated asynchronous write (i3g4250d_async_xfer_ptr).
+  *
+  * @param  handle  Simulated transport (i3g4250d_async_sim_t).(ptr)
+  * @param  reg     Sub-address
+  * @param  buf     Data to write.(ptr)
+  * @param  len     Number of consecutive register to write
+  * @param  done    Completion callback
+  * @param  arg     Argument of the completion callback.(ptr)
+  * @retval         0: request accepted; -1: a transfer is in flight
+  *
+  */
+int32_t i3g4250d_async_sim_write(void *handle, uint8_t reg, uint8_t *buf,
+                                 uint16_t len, i3g4250d_async_done_t done,
+                                 void *arg)
+{
+  return i3g4250d_async_sim_xfer((i3g4250d_async_sim_t *)handle, reg, buf,
+                                 len, PROPERTY_ENABLE, done, arg);
+}
+
+/**
+  * @brief  Deliver the completion of the transfer in flight, if any, as
+  *         the event loop of an asynchronous platform would. A chained
+  *         operation needs one call per transfer.
+  *
+  * @param  sim    Simulated transport instance.(ptr)
+  * @retval        1: a completion was delivered; 0: nothing in flight
+  *
+  */
+uint8_t i3g4250d_async_sim_poll(i3g4250d_async_sim_t *sim)
+{
+  i3g4250d_async_done_t done = sim->done;
+
+  if (sim->pending == 0U) { return 0U; }
+
+  /* cleared first: the completion may request the next transfer */
+  sim->pending = 0U;
+  done(sim->arg, sim->status);
+
+  return 1U;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_drdy_scheduler
+  * @brief      This section groups the predictive data-ready polling
+  *             scheduler, for boards without interrupt lines. The real
+  *             sample period is learned from the observed ZYXDA
+  *             transitions, and the next poll is scheduled a guard time
+  *             before the next expected sample. Each poll reads
+  *             STATUS_REG and the output registers in one burst. The
+  *             guard shrinks when a poll comes too early and grows when
+  *             the sample was already there, so that it tracks the
+  *             clock jitter with few wasted polls.
+  *             Times are given by the caller in microseconds; FIFO must
+  *             be in bypass mode.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Data-ready scheduler initialization, from the output data
+  *         rate currently configured.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  sch    Scheduler instance.(ptr)
+  * @param  now_us Current time [us]
+  * @retval        Interface status (MANDATORY: return 0 -> no Error),
+  *                -1 also when no data is generated (power-down, sleep)
+  *
+  */
+int32_t i3g4250d_drdy_sched_init(const stmdev_ctx_t *ctx,
+                                 i3g4250d_drdy_sched_t *sch, uint64_t now_us)
+{
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  float_t odr;
+  int32_t ret;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  if (ret != 0) { return ret; }
+
+  odr = i3g4250d_odr_hz(ctrl_reg1);
+  if (odr <= 0.0f) { return -1; }
+
+  (void)memset(sch, 0, sizeof(i3g4250d_drdy_sched_t));
+  sch->period_q4 = (uint32_t)(16000000.0f / odr);
+  sch->guard_us = (sch->period_q4 / 16U) / 8U;
+  sch->next_us = now_us;
+
+  return ret;
+}
+
+/**
+  * @brief  Data-ready scheduler poll, to be called at the time returned
+  *         by i3g4250d_drdy_sched_next_get.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  sch    Scheduler instance.(ptr)
+  * @param  now_us Current time [us]
+  * @param  val    Angular rate raw data (X, Y, Z), valid when a new
+  *                sample is ready.(ptr)
+  * @param  ready  1: new sample in val; 0: not yet available.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t i3g4250d_drdy_sched_poll(const stmdev_ctx_t *ctx,
+                                 i3g4250d_drdy_sched_t *sch, uint64_t now_us,
+                                 int16_t *val, uint8_t *ready)
+{
+  i3g4250d_status_reg_t status_reg;
+  uint8_t buf[7];
+  uint32_t period_us;
+  uint32_t max_guard;
+  uint64_t sample_us;
+  uint64_t diff;
+  uint64_t est_q4;
+  uint32_t k;
+  int32_t ret;
+
+  *ready = 0U;
+
+  ret = i3g4250d_read_reg(ctx, I3G4250D_STATUS_REG, buf, 7);
+  if (ret != 0) { return ret; }
+
+  sch->polls++;
+  (void)memcpy(&status_reg, &buf[0], 1);
+  period_us = (sch->period_q4 + 8U) / 16U;
+  max_guard = period_us / 2U;
+
+  if (status_reg.zyxda == PROPERTY_DISABLE)
+  {
+    sch->misses++;
+
+    /* too early: move the first poll of the next samples later */
+    if (sch->missed == 0U)
+    {
+      sch->guard_us -= (sch->guard_us + 3U) / 4U;
+      sch->missed = 1U;
+    }
+
+    sch->next_us = now_us + ((sch->guard_us / 2U) + 1U);
+
+    return ret;
+  }
+
+  (void)memcpy(val, &buf[1], 6);
+  i3g4250d_raw_to_host(ctx, val, 3U);
+  *ready = 1U;
+  sch->samples++;
+
+  /*
+   * A sample found after a miss is dated at the middle of the retry
+   * interval; the period is learned between two such samples, however
+   * many samples were read in between (each read once in bypass mode).
+   * An estimate off by more than a quarter period means samples were
+   * overwritten between the polls, it is dropped. A sample found at
+   * first poll is dated by the prediction, unless later than now or
+   * older than a period (first sample, polls resumed after a pause).
+   */
+  if (sch->missed != 0U)
+  {
+    sample_us = now_us - (((sch->guard_us / 2U) + 1U) / 2U);
+    k = sch->samples - sch->bracket_n;
+
+    if ((sch->bracketed != 0U) && (k > 0U))
+    {
+      diff = sample_us - sch->bracket_us;
+      est_q4 = (diff * 16U) / k;
+
+      if ((est_q4 > (sch->period_q4 - (sch->period_q4 / 4U))) &&
+          (est_q4 < (sch->period_q4 + (sch->period_q4 / 4U))))
+      {
+        sch->period_q4 = (uint32_t)((int64_t)sch->period_q4 +
+                                    (((int64_t)est_q4 -
+                                      (int64_t)sch->period_q4) / 8));
+        period_us = (sch->period_q4 + 8U) / 16U;
+        max_guard = period_us / 2U;
+      }
+    }
+
+    sch->bracket_us = sample_us;
+    sch->bracket_n = sch->samples;
+    sch->bracketed = 1U;
+  }
+
+  /* already there at first poll: the poll may be late, move it earlier */
+  else
+  {
+    sample_us = sch->last_us + period_us;
+    if ((sample_us > now_us) || ((now_us - sample_us) >= period_us))
+    {
+      sample_us = now_us;
+    }
+
+    sch->guard_us += (sch->guard_us / 16U) + 1U;
+  }
+
+  sch->guard_us = (sch->guard_us > max_guard) ? max_guard : sch->guard_us;
+  sch->missed = 0U;
+  sch->last_us = sample_us;
+  sch->next_us = sample_us + (period_us - sch->guard_us);
+
+  return ret;
+}
+
+/**
+  * @brief  Time of the next poll.[get]
+  *
+  * @param  sch    Scheduler instance.(ptr)
+  * @retval        Time to sleep until [us]
+  *
+  */
+uint64_t i3g4250d_drdy_sched_next_get(const i3g4250d_drdy_sched_t *sch)
+{
+  return sch->next_us;
+}
+
+/**
+  * @brief  Learned sample period.[get]
+  *
+  * @param  sch    Scheduler instance.(ptr)
+  * @retval        Sample period [us]
+  *
+  */
+float_t i3g4250d_drdy_sched_period_get(const i3g4250d_drdy_sched_t *sch)
+{
+  return (float_t)sch->period_q4 / 16.0f;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_latency
+  * @brief      This section groups the latency instrumentation of the
+  *             acquisition pipeline. Each stage of a batch (watermark
+  *             interrupt, drain start and end, decode, enqueue, dequeue)
+  *             is timestamped with a user clock; when the batch is
+  *             dequeued the delay of every stage from the previous one,
+  *             and the total delay from the interrupt, are added to
+  *             log-linear histograms (4 bins per octave, 25% resolution)
+  *             from which percentiles are read. Recording a batch costs
+  *             a few shifts and increments, so it can stay enabled.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Histogram bin of a delay.
+  *
+  */
+static uint8_t i3g4250d_lat_bin(uint32_t val)
+{
+  uint32_t v = val;
+  uint8_t e = 0U;
+
+  if (v < 4U) { return (uint8_t)v; }
+
+  /* e = floor(log2(val)) */
+  if (v >= 0x10000U) { v >>= 16; e += 16U; }
+  if (v >= 0x100U)   { v >>= 8;  e += 8U; }
+  if (v >= 0x10U)    { v >>= 4;  e += 4U; }
+  if (v >= 0x4U)     { v >>= 2;  e += 2U; }
+  if (v >= 0x2U)     { e += 1U; }
+
+  return (uint8_t)((4U * (e - 1U)) + ((val >> (e - 2U)) & 0x03U));
+}
+
+/**
+  * @brief  Lowest delay falling in a histogram bin.
+  *
+  */
+static uint32_t i3g4250d_lat_bin_low(uint8_t bin)
+{
+  uint8_t e;
+
+  if (bin < 4U) { return bin; }
+
+  e = (uint8_t)((bin / 4U) + 1U);
+
+  return (uint32_t)((4UL + (bin % 4U)) << (e - 2U));
+}
+
+/**
+  * @brief  Latency instrumentation initialization.
+  *
+  * @param  lat    Instrumentation instance.(ptr)
+  * @param  now    User clock [tick], wrapping around on 32 bits, used by
+  *                i3g4250d_lat_mark; can be NULL if only
+  *                i3g4250d_lat_record is used.(ptr)
+  *
+  */
+void i3g4250d_lat_init(i3g4250d_lat_t *lat, i3g4250d_lat_clock_t now)
+{
+  (void)memset(lat, 0, sizeof(i3g4250d_lat_t));
+  lat->now = now;
+}
+
+/**
+  * @brief  Record the stage timestamps of one batch.
+  *
+  * @param  lat    Instrumentation instance.(ptr)
+  * @param  ts     Timestamp of each stage [tick], indexed by
+  *                i3g4250d_lat_stage_t.(ptr)
+  *
+  */
+void i3g4250d_lat_record(i3g4250d_lat_t *lat, const uint32_t *ts)
+{
+  uint32_t d;
+  uint8_t s;
+
+  for (s = 0U; s < (uint8_t)I3G4250D_STAGE_NUM; s++)
+  {
+    /* slot 0 holds the total, from the interrupt to the dequeue */
+    d = (s == 0U) ? (ts[I3G4250D_STAGE_DEQUEUE] - ts[I3G4250D_STAGE_IRQ]) :
+        (ts[s] - ts[s - 1U]);
+
+    lat->hist[s][i3g4250d_lat_bin(d)]++;
+    lat->max[s] = (d > lat->max[s]) ? d : lat->max[s];
+  }
+
+  lat->count++;
+}
+
+/**
+  * @brief  Timestamp a stage of the current batch with the user clock,
+  *         for pipelines handling one batch at a time. The batch is
+  *         recorded at I3G4250D_STAGE_DEQUEUE.
+  *
+  * @param  lat    Instrumentation instance.(ptr)
+  * @param  stage  Pipeline stage
+  *
+  */
+void i3g4250d_lat_mark(i3g4250d_lat_t *lat, i3g4250d_lat_stage_t stage)
+{
+  lat->ts[stage] = lat->now();
+
+  if (stage == I3G4250D_STAGE_DEQUEUE)
+  {
+    i3g4250d_lat_record(lat, lat->ts);
+  }
+}
+
+/**
+  * @brief  Latency percentile of a stage.[get]
+  *
+  * @param  lat    Instrumentation instance.(ptr)
+  * @param  stage  Stage, delay from the previous one;
+  *                I3G4250D_STAGE_IRQ for the total delay
+  * @param  pct    Percentile (0 to 100)
+  * @param  val    Upper bound of the percentile [tick].(ptr)
+  * @retval        0: done; -1: no batch recorded
+  *
+  */
+int32_t i3g4250d_lat_percentile_get(const i3g4250d_lat_t *lat,
+                                    i3g4250d_lat_stage_t stage, float_t pct,
+                                    uint32_t *val)
+{
+  uint32_t rank;
+  uint32_t acc = 0U;
+  uint8_t b;
+
+  if (lat->count == 0U) { return -1; }
+
+  rank = (uint32_t)(((float_t)lat->count * pct) / 100.0f);
+  rank = (rank < 1U) ? 1U : rank;
+
+  for (b = 0U; b < I3G4250D_LAT_BINS; b++)
+  {
+    acc += lat->hist[stage][b];
+
+    if (acc >= rank)
+    {
+      break;
+    }
+  }
+
+  /* bin upper bound, not above the largest delay seen */
+  *val = (b < (I3G4250D_LAT_BINS - 1U)) ?
+         (i3g4250d_lat_bin_low((uint8_t)(b + 1U)) - 1U) : lat->max[stage];
+  *val = (*val > lat->max[stage]) ? lat->max[stage] : *val;
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
@@ -1,792 +1,1232 @@
-/**
-  ******************************************************************************
-  * @file    i3g4250d_reg.h
-  * @author  Sensors Software Solution Team
-  * @brief   This file contains all the functions prototypes for the
-  *          i3g4250d_reg.c driver.
-  ******************************************************************************
-  * @attention
-  *
-  * Copyright (c) 2021 STMicroelectronics.
-  * All rights reserved.
-  *
-  * This software is licensed under terms that can be found in the LICENSE file
-  * in the root directory of this software component.
-  * If no LICENSE file comes with this software, it is provided AS-IS.
-  *
-  ******************************************************************************
-  */
-
-/* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef I3G4250D_REGS_H
-#define I3G4250D_REGS_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/* Includes ------------------------------------------------------------------*/
-#include <stdint.h>
-#include <stddef.h>
-#include <math.h>
-
-/** @addtogroup I3G4250D
-  * @{
-  *
-  */
-
-/** @defgroup  Endianness definitions
-  * @{
-  *
-  */
-
-#ifndef __BYTE_ORDER__
-
-#define DRV_LITTLE_ENDIAN 1234
-#define DRV_BIG_ENDIAN    4321
-
-/** if DRV_BYTE_ORDER is not defined, choose the endianness of your architecture
-  * by uncommenting the define which fits your platform endianness
-  */
-//#define DRV_BYTE_ORDER         DRV_BIG_ENDIAN
-#define DRV_BYTE_ORDER         DRV_LITTLE_ENDIAN
-
-#else /* defined __BYTE_ORDER__ */
-
-#define DRV_LITTLE_ENDIAN __ORDER_LITTLE_ENDIAN__
-#define DRV_BIG_ENDIAN    __ORDER_BIG_ENDIAN__
-#define DRV_BYTE_ORDER    __BYTE_ORDER__
-
-#endif /* DRV_BYTE_ORDER */
-
-/**
-  * @}
-  *
-  */
-
-/** @defgroup STMicroelectronics sensors common types
-  * @{
-  *
-  */
-
-#ifndef MEMS_SHARED_TYPES
-#define MEMS_SHARED_TYPES
-
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t bit0       : 1;
-  uint8_t bit1       : 1;
-  uint8_t bit2       : 1;
-  uint8_t bit3       : 1;
-  uint8_t bit4       : 1;
-  uint8_t bit5       : 1;
-  uint8_t bit6       : 1;
-  uint8_t bit7       : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t bit7       : 1;
-  uint8_t bit6       : 1;
-  uint8_t bit5       : 1;
-  uint8_t bit4       : 1;
-  uint8_t bit3       : 1;
-  uint8_t bit2       : 1;
-  uint8_t bit1       : 1;
-  uint8_t bit0       : 1;
-#endif /* DRV_BYTE_ORDER */
-} bitwise_t;
-
-#define PROPERTY_DISABLE                (0U)
-#define PROPERTY_ENABLE                 (1U)
-
-/** @addtogroup  Interfaces_Functions
-  * @brief       This section provide a set of functions used to read and
-  *              write a generic register of the device.
-  *              MANDATORY: return 0 -> no Error.
-  * @{
-  *
-  */
-
-typedef int32_t (*stmdev_write_ptr)(
-    void *handle,
-    uint8_t reg,
-    const uint8_t *buf,
-    uint16_t len);
-
-typedef int32_t (*stmdev_read_ptr)(
-    void *handle,
-    uint8_t reg,
-    uint8_t *buf,
-    uint16_t len);
-
-typedef void (*stmdev_mdelay_ptr)(uint32_t millisec);
-
-typedef struct
-{
-  /** Component mandatory fields **/
-  stmdev_write_ptr  write_reg;
-  stmdev_read_ptr   read_reg;
-  /** Component optional fields **/
-  stmdev_mdelay_ptr   mdelay;
-  /** Customizable optional pointer **/
-  void *handle;
-
-  /** private data **/
-  void *priv_data;
-} stmdev_ctx_t;
-
-/**
-  * @}
-  *
-  */
-
-#endif /* MEMS_SHARED_TYPES */
-
-#ifndef MEMS_UCF_SHARED_TYPES
-#define MEMS_UCF_SHARED_TYPES
-
-/** @defgroup    Generic address-data structure definition
-  * @brief       This structure is useful to load a predefined configuration
-  *              of a sensor.
-  *              You can create a sensor configuration by your own or using
-  *              Unico / Unicleo tools available on STMicroelectronics
-  *              web site.
-  *
-  * @{
-  *
-  */
-
-typedef struct
-{
-  uint8_t address;
-  uint8_t data;
-} ucf_line_t;
-
-/**
-  * @}
-  *
-  */
-
-#endif /* MEMS_UCF_SHARED_TYPES */
-
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup i3g4250d_Infos
-  * @{
-  *
-  */
-
-/** I2C Device Address 8 bit format  if SA0=0 -> 0xD1 if SA0=1 -> 0xD3 **/
-#define I3G4250D_I2C_ADD_L               0xD1U
-#define I3G4250D_I2C_ADD_H               0xD3U
-
-/** Device Identification (Who am I) **/
-#define I3G4250D_ID                      0xD3U
-
-/**
-  * @}
-  *
-  */
-
-#define I3G4250D_WHO_AM_I                0x0FU
-#define I3G4250D_CTRL_REG1               0x20U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t pd                        : 4; /* xen yen zen pd */
-  uint8_t bw                        : 2;
-  uint8_t dr                        : 2;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t dr                        : 2;
-  uint8_t bw                        : 2;
-  uint8_t pd                        : 4; /* xen yen zen pd */
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_ctrl_reg1_t;
-
-#define I3G4250D_CTRL_REG2               0x21U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t hpcf                      : 4;
-  uint8_t hpm                       : 2;
-  uint8_t not_used_01               : 2;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t not_used_01               : 2;
-  uint8_t hpm                       : 2;
-  uint8_t hpcf                      : 4;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_ctrl_reg2_t;
-
-#define I3G4250D_CTRL_REG3               0x22U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t i2_empty                  : 1;
-  uint8_t i2_orun                   : 1;
-  uint8_t i2_wtm                    : 1;
-  uint8_t i2_drdy                   : 1;
-  uint8_t pp_od                     : 1;
-  uint8_t h_lactive                 : 1;
-  uint8_t i1_boot                   : 1;
-  uint8_t i1_int1                   : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t i1_int1                   : 1;
-  uint8_t i1_boot                   : 1;
-  uint8_t h_lactive                 : 1;
-  uint8_t pp_od                     : 1;
-  uint8_t i2_drdy                   : 1;
-  uint8_t i2_wtm                    : 1;
-  uint8_t i2_orun                   : 1;
-  uint8_t i2_empty                  : 1;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_ctrl_reg3_t;
-
-#define I3G4250D_CTRL_REG4               0x23U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t sim                       : 1;
-  uint8_t st                        : 2;
-  uint8_t not_used_01               : 1;
-  uint8_t fs                        : 2;
-  uint8_t ble                       : 1;
-  uint8_t not_used_02               : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t not_used_02               : 1;
-  uint8_t ble                       : 1;
-  uint8_t fs                        : 2;
-  uint8_t not_used_01               : 1;
-  uint8_t st                        : 2;
-  uint8_t sim                       : 1;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_ctrl_reg4_t;
-
-#define I3G4250D_CTRL_REG5               0x24U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t out_sel                   : 2;
-  uint8_t int1_sel                  : 2;
-  uint8_t hpen                      : 1;
-  uint8_t not_used_01               : 1;
-  uint8_t fifo_en                   : 1;
-  uint8_t boot                      : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t boot                      : 1;
-  uint8_t fifo_en                   : 1;
-  uint8_t not_used_01               : 1;
-  uint8_t hpen                      : 1;
-  uint8_t int1_sel                  : 2;
-  uint8_t out_sel                   : 2;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_ctrl_reg5_t;
-
-#define I3G4250D_REFERENCE               0x25U
-typedef struct
-{
-  uint8_t ref                       : 8;
-} i3g4250d_reference_t;
-
-#define I3G4250D_OUT_TEMP                0x26U
-#define I3G4250D_STATUS_REG              0x27U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t xda                       : 1;
-  uint8_t yda                       : 1;
-  uint8_t zda                       : 1;
-  uint8_t zyxda                     : 1;
-  uint8_t _xor                      : 1;
-  uint8_t yor                       : 1;
-  uint8_t zor                       : 1;
-  uint8_t zyxor                     : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t zyxor                     : 1;
-  uint8_t zor                       : 1;
-  uint8_t yor                       : 1;
-  uint8_t _xor                      : 1;
-  uint8_t zyxda                     : 1;
-  uint8_t zda                       : 1;
-  uint8_t yda                       : 1;
-  uint8_t xda                       : 1;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_status_reg_t;
-
-#define I3G4250D_OUT_X_L                 0x28U
-#define I3G4250D_OUT_X_H                 0x29U
-#define I3G4250D_OUT_Y_L                 0x2AU
-#define I3G4250D_OUT_Y_H                 0x2BU
-#define I3G4250D_OUT_Z_L                 0x2CU
-#define I3G4250D_OUT_Z_H                 0x2DU
-#define I3G4250D_FIFO_CTRL_REG           0x2EU
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t wtm                       : 5;
-  uint8_t fm                        : 3;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t fm                        : 3;
-  uint8_t wtm                       : 5;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_fifo_ctrl_reg_t;
-
-#define I3G4250D_FIFO_SRC_REG            0x2FU
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t fss                       : 5;
-  uint8_t empty                     : 1;
-  uint8_t ovrn                      : 1;
-  uint8_t wtm                       : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t wtm                       : 1;
-  uint8_t ovrn                      : 1;
-  uint8_t empty                     : 1;
-  uint8_t fss                       : 5;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_fifo_src_reg_t;
-
-#define I3G4250D_INT1_CFG                0x30U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t xlie                      : 1;
-  uint8_t xhie                      : 1;
-  uint8_t ylie                      : 1;
-  uint8_t yhie                      : 1;
-  uint8_t zlie                      : 1;
-  uint8_t zhie                      : 1;
-  uint8_t lir                       : 1;
-  uint8_t and_or                    : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t and_or                    : 1;
-  uint8_t lir                       : 1;
-  uint8_t zhie                      : 1;
-  uint8_t zlie                      : 1;
-  uint8_t yhie                      : 1;
-  uint8_t ylie                      : 1;
-  uint8_t xhie                      : 1;
-  uint8_t xlie                      : 1;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_int1_cfg_t;
-
-#define I3G4250D_INT1_SRC                0x31U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t xl                        : 1;
-  uint8_t xh                        : 1;
-  uint8_t yl                        : 1;
-  uint8_t yh                        : 1;
-  uint8_t zl                        : 1;
-  uint8_t zh                        : 1;
-  uint8_t ia                        : 1;
-  uint8_t not_used_01               : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t not_used_01               : 1;
-  uint8_t ia                        : 1;
-  uint8_t zh                        : 1;
-  uint8_t zl                        : 1;
-  uint8_t yh                        : 1;
-  uint8_t yl                        : 1;
-  uint8_t xh                        : 1;
-  uint8_t xl                        : 1;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_int1_src_t;
-
-#define I3G4250D_INT1_TSH_XH             0x32U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t thsx                      : 7;
-  uint8_t not_used_01               : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t not_used_01               : 1;
-  uint8_t thsx                      : 7;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_int1_tsh_xh_t;
-
-#define I3G4250D_INT1_TSH_XL             0x33U
-typedef struct
-{
-  uint8_t thsx                      : 8;
-} i3g4250d_int1_tsh_xl_t;
-
-#define I3G4250D_INT1_TSH_YH             0x34U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t thsy                      : 7;
-  uint8_t not_used_01               : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t not_used_01               : 1;
-  uint8_t thsy                      : 7;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_int1_tsh_yh_t;
-
-#define I3G4250D_INT1_TSH_YL             0x35U
-typedef struct
-{
-  uint8_t thsy                      : 8;
-} i3g4250d_int1_tsh_yl_t;
-
-#define I3G4250D_INT1_TSH_ZH             0x36U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t thsz                      : 7;
-  uint8_t not_used_01               : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t not_used_01               : 1;
-  uint8_t thsz                      : 7;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_int1_tsh_zh_t;
-
-#define I3G4250D_INT1_TSH_ZL             0x37U
-typedef struct
-{
-  uint8_t thsz                      : 8;
-} i3g4250d_int1_tsh_zl_t;
-
-#define I3G4250D_INT1_DURATION           0x38U
-typedef struct
-{
-#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
-  uint8_t d                         : 7;
-  uint8_t wait                      : 1;
-#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
-  uint8_t wait                      : 1;
-  uint8_t d                         : 7;
-#endif /* DRV_BYTE_ORDER */
-} i3g4250d_int1_duration_t;
-
-/**
-  * @defgroup LSM9DS1_Register_Union
-  * @brief    This union group all the registers having a bit-field
-  *           description.
-  *           This union is useful but it's not needed by the driver.
-  *
-  *           REMOVING this union you are compliant with:
-  *           MISRA-C 2012 [Rule 19.2] -> " Union are not allowed "
-  *
-  * @{
-  *
-  */
-
-typedef union
-{
-  i3g4250d_ctrl_reg1_t        ctrl_reg1;
-  i3g4250d_ctrl_reg2_t        ctrl_reg2;
-  i3g4250d_ctrl_reg3_t        ctrl_reg3;
-  i3g4250d_ctrl_reg4_t        ctrl_reg4;
-  i3g4250d_ctrl_reg5_t        ctrl_reg5;
-  i3g4250d_reference_t        reference;
-  i3g4250d_status_reg_t       status_reg;
-  i3g4250d_fifo_ctrl_reg_t    fifo_ctrl_reg;
-  i3g4250d_fifo_src_reg_t     fifo_src_reg;
-  i3g4250d_int1_cfg_t         int1_cfg;
-  i3g4250d_int1_src_t         int1_src;
-  i3g4250d_int1_tsh_xh_t      int1_tsh_xh;
-  i3g4250d_int1_tsh_xl_t      int1_tsh_xl;
-  i3g4250d_int1_tsh_yh_t      int1_tsh_yh;
-  i3g4250d_int1_tsh_yl_t      int1_tsh_yl;
-  i3g4250d_int1_tsh_zh_t      int1_tsh_zh;
-  i3g4250d_int1_tsh_zl_t      int1_tsh_zl;
-  i3g4250d_int1_duration_t    int1_duration;
-  bitwise_t                   bitwise;
-  uint8_t                     byte;
-} i3g4250d_reg_t;
-
-/**
-  * @}
-  *
-  */
-
-#ifndef __weak
-#define __weak __attribute__((weak))
-#endif /* __weak */
-
-/*
- * These are the basic platform dependent I/O routines to read
- * and write device registers connected on a standard bus.
- * The driver keeps offering a default implementation based on function
- * pointers to read/write routines for backward compatibility.
- * The __weak directive allows the final application to overwrite
- * them with a custom implementation.
- */
-
-int32_t i3g4250d_read_reg(const stmdev_ctx_t *ctx, uint8_t reg,
-                          uint8_t *data,
-                          uint16_t len);
-int32_t i3g4250d_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
-                           uint8_t *data,
-                           uint16_t len);
-
-float_t i3g4250d_from_fs245dps_to_mdps(int16_t lsb);
-float_t i3g4250d_from_lsb_to_celsius(int16_t lsb);
-
-int32_t i3g4250d_axis_x_data_set(const stmdev_ctx_t *ctx, uint8_t val);
-int32_t i3g4250d_axis_x_data_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-int32_t i3g4250d_axis_y_data_set(const stmdev_ctx_t *ctx, uint8_t val);
-int32_t i3g4250d_axis_y_data_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-int32_t i3g4250d_axis_z_data_set(const stmdev_ctx_t *ctx, uint8_t val);
-int32_t i3g4250d_axis_z_data_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-typedef enum
-{
-  I3G4250D_ODR_OFF     = 0x00,
-  I3G4250D_ODR_SLEEP   = 0x08,
-  I3G4250D_ODR_100Hz   = 0x0F,
-  I3G4250D_ODR_200Hz   = 0x1F,
-  I3G4250D_ODR_400Hz   = 0x2F,
-  I3G4250D_ODR_800Hz   = 0x3F,
-} i3g4250d_dr_t;
-int32_t i3g4250d_data_rate_set(const stmdev_ctx_t *ctx, i3g4250d_dr_t val);
-int32_t i3g4250d_data_rate_get(const stmdev_ctx_t *ctx, i3g4250d_dr_t *val);
-
-typedef enum
-{
-  I3G4250D_245dps     = 0x00,
-  I3G4250D_500dps     = 0x01,
-  I3G4250D_2000dps    = 0x02,
-} i3g4250d_fs_t;
-int32_t i3g4250d_full_scale_set(const stmdev_ctx_t *ctx, i3g4250d_fs_t val);
-int32_t i3g4250d_full_scale_get(const stmdev_ctx_t *ctx,
-                                i3g4250d_fs_t *val);
-
-int32_t i3g4250d_status_reg_get(const stmdev_ctx_t *ctx,
-                                i3g4250d_status_reg_t *val);
-
-int32_t i3g4250d_flag_data_ready_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-int32_t i3g4250d_temperature_raw_get(const stmdev_ctx_t *ctx,
-                                     uint8_t *buff);
-
-int32_t i3g4250d_angular_rate_raw_get(const stmdev_ctx_t *ctx,
-                                      int16_t *val);
-
-int32_t i3g4250d_device_id_get(const stmdev_ctx_t *ctx, uint8_t *buff);
-
-typedef enum
-{
-  I3G4250D_GY_ST_DISABLE    = 0,
-  I3G4250D_GY_ST_POSITIVE   = 1,
-  I3G4250D_GY_ST_NEGATIVE   = 3,
-} i3g4250d_st_t;
-int32_t i3g4250d_self_test_set(const stmdev_ctx_t *ctx, i3g4250d_st_t val);
-int32_t i3g4250d_self_test_get(const stmdev_ctx_t *ctx, i3g4250d_st_t *val);
-
-typedef enum
-{
-  I3G4250D_AUX_LSB_AT_LOW_ADD   = 0,
-  I3G4250D_AUX_MSB_AT_LOW_ADD   = 1,
-} i3g4250d_ble_t;
-int32_t i3g4250d_data_format_set(const stmdev_ctx_t *ctx,
-                                 i3g4250d_ble_t val);
-int32_t i3g4250d_data_format_get(const stmdev_ctx_t *ctx,
-                                 i3g4250d_ble_t *val);
-
-int32_t i3g4250d_boot_set(const stmdev_ctx_t *ctx, uint8_t val);
-int32_t i3g4250d_boot_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-typedef enum
-{
-  I3G4250D_CUT_OFF_LOW        = 0,
-  I3G4250D_CUT_OFF_MEDIUM     = 1,
-  I3G4250D_CUT_OFF_HIGH       = 2,
-  I3G4250D_CUT_OFF_VERY_HIGH  = 3,
-} i3g4250d_bw_t;
-int32_t i3g4250d_lp_bandwidth_set(const stmdev_ctx_t *ctx,
-                                  i3g4250d_bw_t val);
-int32_t i3g4250d_lp_bandwidth_get(const stmdev_ctx_t *ctx,
-                                  i3g4250d_bw_t *val);
-
-typedef enum
-{
-  I3G4250D_HP_LEVEL_0   = 0,
-  I3G4250D_HP_LEVEL_1   = 1,
-  I3G4250D_HP_LEVEL_2   = 2,
-  I3G4250D_HP_LEVEL_3   = 3,
-  I3G4250D_HP_LEVEL_4   = 4,
-  I3G4250D_HP_LEVEL_5   = 5,
-  I3G4250D_HP_LEVEL_6   = 6,
-  I3G4250D_HP_LEVEL_7   = 7,
-  I3G4250D_HP_LEVEL_8   = 8,
-  I3G4250D_HP_LEVEL_9   = 9,
-} i3g4250d_hpcf_t;
-int32_t i3g4250d_hp_bandwidth_set(const stmdev_ctx_t *ctx,
-                                  i3g4250d_hpcf_t val);
-int32_t i3g4250d_hp_bandwidth_get(const stmdev_ctx_t *ctx,
-                                  i3g4250d_hpcf_t *val);
-
-typedef enum
-{
-  I3G4250D_HP_NORMAL_MODE_WITH_RST  = 0,
-  I3G4250D_HP_REFERENCE_SIGNAL      = 1,
-  I3G4250D_HP_NORMAL_MODE           = 2,
-  I3G4250D_HP_AUTO_RESET_ON_INT     = 3,
-} i3g4250d_hpm_t;
-int32_t i3g4250d_hp_mode_set(const stmdev_ctx_t *ctx, i3g4250d_hpm_t val);
-int32_t i3g4250d_hp_mode_get(const stmdev_ctx_t *ctx, i3g4250d_hpm_t *val);
-
-typedef enum
-{
-  I3G4250D_ONLY_LPF1_ON_OUT     = 0,
-  I3G4250D_LPF1_HP_ON_OUT       = 1,
-  I3G4250D_LPF1_LPF2_ON_OUT     = 2,
-  I3G4250D_LPF1_HP_LPF2_ON_OUT  = 6,
-} i3g4250d_out_sel_t;
-int32_t i3g4250d_filter_path_set(const stmdev_ctx_t *ctx,
-                                 i3g4250d_out_sel_t val);
-int32_t i3g4250d_filter_path_get(const stmdev_ctx_t *ctx,
-                                 i3g4250d_out_sel_t *val);
-
-typedef enum
-{
-  I3G4250D_ONLY_LPF1_ON_INT     = 0,
-  I3G4250D_LPF1_HP_ON_INT       = 1,
-  I3G4250D_LPF1_LPF2_ON_INT     = 2,
-  I3G4250D_LPF1_HP_LPF2_ON_INT  = 6,
-} i3g4250d_int1_sel_t;
-int32_t i3g4250d_filter_path_internal_set(const stmdev_ctx_t *ctx,
-                                          i3g4250d_int1_sel_t val);
-int32_t i3g4250d_filter_path_internal_get(const stmdev_ctx_t *ctx,
-                                          i3g4250d_int1_sel_t *val);
-
-int32_t i3g4250d_hp_reference_value_set(const stmdev_ctx_t *ctx,
-                                        uint8_t val);
-int32_t i3g4250d_hp_reference_value_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val);
-
-typedef enum
-{
-  I3G4250D_SPI_4_WIRE  = 0,
-  I3G4250D_SPI_3_WIRE  = 1,
-} i3g4250d_sim_t;
-int32_t i3g4250d_spi_mode_set(const stmdev_ctx_t *ctx, i3g4250d_sim_t val);
-int32_t i3g4250d_spi_mode_get(const stmdev_ctx_t *ctx, i3g4250d_sim_t *val);
-
-typedef struct
-{
-  uint8_t i1_int1             : 1;
-  uint8_t i1_boot             : 1;
-} i3g4250d_int1_route_t;
-int32_t i3g4250d_pin_int1_route_set(const stmdev_ctx_t *ctx,
-                                    i3g4250d_int1_route_t val);
-int32_t i3g4250d_pin_int1_route_get(const stmdev_ctx_t *ctx,
-                                    i3g4250d_int1_route_t *val);
-
-typedef struct
-{
-  uint8_t i2_empty             : 1;
-  uint8_t i2_orun              : 1;
-  uint8_t i2_wtm               : 1;
-  uint8_t i2_drdy              : 1;
-} i3g4250d_int2_route_t;
-int32_t i3g4250d_pin_int2_route_set(const stmdev_ctx_t *ctx,
-                                    i3g4250d_int2_route_t val);
-int32_t i3g4250d_pin_int2_route_get(const stmdev_ctx_t *ctx,
-                                    i3g4250d_int2_route_t *val);
-
-typedef enum
-{
-  I3G4250D_PUSH_PULL   = 0,
-  I3G4250D_OPEN_DRAIN  = 1,
-} i3g4250d_pp_od_t;
-int32_t i3g4250d_pin_mode_set(const stmdev_ctx_t *ctx,
-                              i3g4250d_pp_od_t val);
-int32_t i3g4250d_pin_mode_get(const stmdev_ctx_t *ctx,
-                              i3g4250d_pp_od_t *val);
-
-typedef enum
-{
-  I3G4250D_ACTIVE_HIGH  = 0,
-  I3G4250D_ACTIVE_LOW   = 1,
-} i3g4250d_h_lactive_t;
-int32_t i3g4250d_pin_polarity_set(const stmdev_ctx_t *ctx,
-                                  i3g4250d_h_lactive_t val);
-int32_t i3g4250d_pin_polarity_get(const stmdev_ctx_t *ctx,
-                                  i3g4250d_h_lactive_t *val);
-
-typedef enum
-{
-  I3G4250D_INT_PULSED   = 0,
-  I3G4250D_INT_LATCHED  = 1,
-} i3g4250d_lir_t;
-int32_t i3g4250d_int_notification_set(const stmdev_ctx_t *ctx,
-                                      i3g4250d_lir_t val);
-int32_t i3g4250d_int_notification_get(const stmdev_ctx_t *ctx,
-                                      i3g4250d_lir_t *val);
-
-int32_t i3g4250d_int_on_threshold_conf_set(const stmdev_ctx_t *ctx,
-                                           i3g4250d_int1_cfg_t *val);
-int32_t i3g4250d_int_on_threshold_conf_get(const stmdev_ctx_t *ctx,
-                                           i3g4250d_int1_cfg_t *val);
-
-typedef enum
-{
-  I3G4250D_INT1_ON_TH_AND  = 1,
-  I3G4250D_INT1_ON_TH_OR   = 0,
-} i3g4250d_and_or_t;
-int32_t i3g4250d_int_on_threshold_mode_set(const stmdev_ctx_t *ctx,
-                                           i3g4250d_and_or_t val);
-int32_t i3g4250d_int_on_threshold_mode_get(const stmdev_ctx_t *ctx,
-                                           i3g4250d_and_or_t *val);
-
-int32_t i3g4250d_int_on_threshold_src_get(const stmdev_ctx_t *ctx,
-                                          i3g4250d_int1_src_t *val);
-
-int32_t i3g4250d_int_x_threshold_set(const stmdev_ctx_t *ctx, uint16_t val);
-int32_t i3g4250d_int_x_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val);
-
-int32_t i3g4250d_int_y_threshold_set(const stmdev_ctx_t *ctx, uint16_t val);
-int32_t i3g4250d_int_y_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val);
-
-int32_t i3g4250d_int_z_threshold_set(const stmdev_ctx_t *ctx, uint16_t val);
-int32_t i3g4250d_int_z_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val);
-
-int32_t i3g4250d_int_on_threshold_dur_set(const stmdev_ctx_t *ctx,
-                                          uint8_t val);
-int32_t i3g4250d_int_on_threshold_dur_get(const stmdev_ctx_t *ctx,
-                                          uint8_t *val);
-
-int32_t i3g4250d_fifo_enable_set(const stmdev_ctx_t *ctx, uint8_t val);
-int32_t i3g4250d_fifo_enable_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-int32_t i3g4250d_fifo_watermark_set(const stmdev_ctx_t *ctx, uint8_t val);
-int32_t i3g4250d_fifo_watermark_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-typedef enum
-{
-  I3G4250D_FIFO_BYPASS_MODE     = 0x00,
-  I3G4250D_FIFO_MODE            = 0x01,
-  I3G4250D_FIFO_STREAM_MODE     = 0x02,
-} i3g4250d_fifo_mode_t;
-int32_t i3g4250d_fifo_mode_set(const stmdev_ctx_t *ctx,
-                               i3g4250d_fifo_mode_t val);
-int32_t i3g4250d_fifo_mode_get(const stmdev_ctx_t *ctx,
-                               i3g4250d_fifo_mode_t *val);
-
-int32_t i3g4250d_fifo_data_level_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-int32_t i3g4250d_fifo_empty_flag_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-int32_t i3g4250d_fifo_ovr_flag_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-int32_t i3g4250d_fifo_wtm_flag_get(const stmdev_ctx_t *ctx, uint8_t *val);
-
-/**
-  * @}
-  *
-  */
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* I3G4250D_REGS_H */
+/**
+  ******************************************************************************
+  * @file    i3g4250d_reg.h
+  * @author  Sensors Software Solution Team
+  * @brief   This file contains all the functions prototypes for the
+  *          i3g4250d_reg.c driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_REGS_H
+#define I3G4250D_REGS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+/** @defgroup  Endianness definitions
+  * @{
+  *
+  */
+
+#ifndef __BYTE_ORDER__
+
+#define DRV_LITTLE_ENDIAN 1234
+#define DRV_BIG_ENDIAN    4321
+
+/** if DRV_BYTE_ORDER is not defined, choose the endianness of your architecture
+  * by uncommenting the define which fits your platform endianness
+  */
+//#define DRV_BYTE_ORDER         DRV_BIG_ENDIAN
+#define DRV_BYTE_ORDER         DRV_LITTLE_ENDIAN
+
+#else /* defined __BYTE_ORDER__ */
+
+#define DRV_LITTLE_ENDIAN __ORDER_LITTLE_ENDIAN__
+#define DRV_BIG_ENDIAN    __ORDER_BIG_ENDIAN__
+#define DRV_BYTE_ORDER    __BYTE_ORDER__
+
+#endif /* DRV_BYTE_ORDER */
+
+/**
+  * @}
+  *
+  */
+
+/** @defgroup STMicroelectronics sensors common types
+  * @{
+  *
+  */
+
+#ifndef MEMS_SHARED_TYPES
+#define MEMS_SHARED_TYPES
+
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t bit0       : 1;
+  uint8_t bit1       : 1;
+  uint8_t bit2       : 1;
+  uint8_t bit3       : 1;
+  uint8_t bit4       : 1;
+  uint8_t bit5       : 1;
+  uint8_t bit6       : 1;
+  uint8_t bit7       : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t bit7       : 1;
+  uint8_t bit6       : 1;
+  uint8_t bit5       : 1;
+  uint8_t bit4       : 1;
+  uint8_t bit3       : 1;
+  uint8_t bit2       : 1;
+  uint8_t bit1       : 1;
+  uint8_t bit0       : 1;
+#endif /* DRV_BYTE_ORDER */
+} bitwise_t;
+
+#define PROPERTY_DISABLE                (0U)
+#define PROPERTY_ENABLE                 (1U)
+
+/** @addtogroup  Interfaces_Functions
+  * @brief       This section provide a set of functions used to read and
+  *              write a generic register of the device.
+  *              MANDATORY: return 0 -> no Error.
+  * @{
+  *
+  */
+
+typedef int32_t (*stmdev_write_ptr)(
+    void *handle,
+    uint8_t reg,
+    const uint8_t *buf,
+    uint16_t len);
+
+typedef int32_t (*stmdev_read_ptr)(
+    void *handle,
+    uint8_t reg,
+    uint8_t *buf,
+    uint16_t len);
+
+typedef void (*stmdev_mdelay_ptr)(uint32_t millisec);
+
+typedef struct
+{
+  /** Component mandatory fields **/
+  stmdev_write_ptr  write_reg;
+  stmdev_read_ptr   read_reg;
+  /** Component optional fields **/
+  stmdev_mdelay_ptr   mdelay;
+  /** Customizable optional pointer **/
+  void *handle;
+
+  /** private data **/
+  void *priv_data;
+} stmdev_ctx_t;
+
+/**
+  * @}
+  *
+  */
+
+#endif /* MEMS_SHARED_TYPES */
+
+#ifndef MEMS_UCF_SHARED_TYPES
+#define MEMS_UCF_SHARED_TYPES
+
+/** @defgroup    Generic address-data structure definition
+  * @brief       This structure is useful to load a predefined configuration
+  *              of a sensor.
+  *              You can create a sensor configuration by your own or using
+  *              Unico / Unicleo tools available on STMicroelectronics
+  *              web site.
+  *
+  * @{
+  *
+  */
+
+typedef struct
+{
+  uint8_t address;
+  uint8_t data;
+} ucf_line_t;
+
+/**
+  * @}
+  *
+  */
+
+#endif /* MEMS_UCF_SHARED_TYPES */
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup i3g4250d_Infos
+  * @{
+  *
+  */
+
+/** I2C Device Address 8 bit format  if SA0=0 -> 0xD1 if SA0=1 -> 0xD3 **/
+#define I3G4250D_I2C_ADD_L               0xD1U
+#define I3G4250D_I2C_ADD_H               0xD3U
+
+/** Device Identification (Who am I) **/
+#define I3G4250D_ID                      0xD3U
+
+/**
+  * @}
+  *
+  */
+
+#define I3G4250D_WHO_AM_I                0x0FU
+#define I3G4250D_CTRL_REG1               0x20U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t pd                        : 4; /* xen yen zen pd */
+  uint8_t bw                        : 2;
+  uint8_t dr                        : 2;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t dr                        : 2;
+  uint8_t bw                        : 2;
+  uint8_t pd                        : 4; /* xen yen zen pd */
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_ctrl_reg1_t;
+
+#define I3G4250D_CTRL_REG2               0x21U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t hpcf                      : 4;
+  uint8_t hpm                       : 2;
+  uint8_t not_used_01               : 2;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t not_used_01               : 2;
+  uint8_t hpm                       : 2;
+  uint8_t hpcf                      : 4;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_ctrl_reg2_t;
+
+#define I3G4250D_CTRL_REG3               0x22U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t i2_empty                  : 1;
+  uint8_t i2_orun                   : 1;
+  uint8_t i2_wtm                    : 1;
+  uint8_t i2_drdy                   : 1;
+  uint8_t pp_od                     : 1;
+  uint8_t h_lactive                 : 1;
+  uint8_t i1_boot                   : 1;
+  uint8_t i1_int1                   : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t i1_int1                   : 1;
+  uint8_t i1_boot                   : 1;
+  uint8_t h_lactive                 : 1;
+  uint8_t pp_od                     : 1;
+  uint8_t i2_drdy                   : 1;
+  uint8_t i2_wtm                    : 1;
+  uint8_t i2_orun                   : 1;
+  uint8_t i2_empty                  : 1;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_ctrl_reg3_t;
+
+#define I3G4250D_CTRL_REG4               0x23U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t sim                       : 1;
+  uint8_t st                        : 2;
+  uint8_t not_used_01               : 1;
+  uint8_t fs                        : 2;
+  uint8_t ble                       : 1;
+  uint8_t not_used_02               : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t not_used_02               : 1;
+  uint8_t ble                       : 1;
+  uint8_t fs                        : 2;
+  uint8_t not_used_01               : 1;
+  uint8_t st                        : 2;
+  uint8_t sim                       : 1;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_ctrl_reg4_t;
+
+#define I3G4250D_CTRL_REG5               0x24U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t out_sel                   : 2;
+  uint8_t int1_sel                  : 2;
+  uint8_t hpen                      : 1;
+  uint8_t not_used_01               : 1;
+  uint8_t fifo_en                   : 1;
+  uint8_t boot                      : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t boot                      : 1;
+  uint8_t fifo_en                   : 1;
+  uint8_t not_used_01               : 1;
+  uint8_t hpen                      : 1;
+  uint8_t int1_sel                  : 2;
+  uint8_t out_sel                   : 2;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_ctrl_reg5_t;
+
+#define I3G4250D_REFERENCE               0x25U
+typedef struct
+{
+  uint8_t ref                       : 8;
+} i3g4250d_reference_t;
+
+#define I3G4250D_OUT_TEMP                0x26U
+#define I3G4250D_STATUS_REG              0x27U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t xda                       : 1;
+  uint8_t yda                       : 1;
+  uint8_t zda                       : 1;
+  uint8_t zyxda                     : 1;
+  uint8_t _xor                      : 1;
+  uint8_t yor                       : 1;
+  uint8_t zor                       : 1;
+  uint8_t zyxor                     : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t zyxor                     : 1;
+  uint8_t zor                       : 1;
+  uint8_t yor                       : 1;
+  uint8_t _xor                      : 1;
+  uint8_t zyxda                     : 1;
+  uint8_t zda                       : 1;
+  uint8_t yda                       : 1;
+  uint8_t xda                       : 1;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_status_reg_t;
+
+#define I3G4250D_OUT_X_L                 0x28U
+#define I3G4250D_OUT_X_H                 0x29U
+#define I3G4250D_OUT_Y_L                 0x2AU
+#define I3G4250D_OUT_Y_H                 0x2BU
+#define I3G4250D_OUT_Z_L                 0x2CU
+#define I3G4250D_OUT_Z_H                 0x2DU
+#define I3G4250D_FIFO_CTRL_REG           0x2EU
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t wtm                       : 5;
+  uint8_t fm                        : 3;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t fm                        : 3;
+  uint8_t wtm                       : 5;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_fifo_ctrl_reg_t;
+
+#define I3G4250D_FIFO_SRC_REG            0x2FU
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t fss                       : 5;
+  uint8_t empty                     : 1;
+  uint8_t ovrn                      : 1;
+  uint8_t wtm                       : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t wtm                       : 1;
+  uint8_t ovrn                      : 1;
+  uint8_t empty                     : 1;
+  uint8_t fss                       : 5;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_fifo_src_reg_t;
+
+#define I3G4250D_INT1_CFG                0x30U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t xlie                      : 1;
+  uint8_t xhie                      : 1;
+  uint8_t ylie                      : 1;
+  uint8_t yhie                      : 1;
+  uint8_t zlie                      : 1;
+  uint8_t zhie                      : 1;
+  uint8_t lir                       : 1;
+  uint8_t and_or                    : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t and_or                    : 1;
+  uint8_t lir                       : 1;
+  uint8_t zhie                      : 1;
+  uint8_t zlie                      : 1;
+  uint8_t yhie                      : 1;
+  uint8_t ylie                      : 1;
+  uint8_t xhie                      : 1;
+  uint8_t xlie                      : 1;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_int1_cfg_t;
+
+#define I3G4250D_INT1_SRC                0x31U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t xl                        : 1;
+  uint8_t xh                        : 1;
+  uint8_t yl                        : 1;
+  uint8_t yh                        : 1;
+  uint8_t zl                        : 1;
+  uint8_t zh                        : 1;
+  uint8_t ia                        : 1;
+  uint8_t not_used_01               : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t not_used_01               : 1;
+  uint8_t ia                        : 1;
+  uint8_t zh                        : 1;
+  uint8_t zl                        : 1;
+  uint8_t yh                        : 1;
+  uint8_t yl                        : 1;
+  uint8_t xh                        : 1;
+  uint8_t xl                        : 1;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_int1_src_t;
+
+#define I3G4250D_INT1_TSH_XH             0x32U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t thsx                      : 7;
+  uint8_t not_used_01               : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t not_used_01               : 1;
+  uint8_t thsx                      : 7;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_int1_tsh_xh_t;
+
+#define I3G4250D_INT1_TSH_XL             0x33U
+typedef struct
+{
+  uint8_t thsx                      : 8;
+} i3g4250d_int1_tsh_xl_t;
+
+#define I3G4250D_INT1_TSH_YH             0x34U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t thsy                      : 7;
+  uint8_t not_used_01               : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t not_used_01               : 1;
+  uint8_t thsy                      : 7;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_int1_tsh_yh_t;
+
+#define I3G4250D_INT1_TSH_YL             0x35U
+typedef struct
+{
+  uint8_t thsy                      : 8;
+} i3g4250d_int1_tsh_yl_t;
+
+#define I3G4250D_INT1_TSH_ZH             0x36U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t thsz                      : 7;
+  uint8_t not_used_01               : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t not_used_01               : 1;
+  uint8_t thsz                      : 7;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_int1_tsh_zh_t;
+
+#define I3G4250D_INT1_TSH_ZL             0x37U
+typedef struct
+{
+  uint8_t thsz                      : 8;
+} i3g4250d_int1_tsh_zl_t;
+
+#define I3G4250D_INT1_DURATION           0x38U
+typedef struct
+{
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+  uint8_t d                         : 7;
+  uint8_t wait                      : 1;
+#elif DRV_BYTE_ORDER == DRV_BIG_ENDIAN
+  uint8_t wait                      : 1;
+  uint8_t d                         : 7;
+#endif /* DRV_BYTE_ORDER */
+} i3g4250d_int1_duration_t;
+
+/**
+  * @defgroup LSM9DS1_Register_Union
+  * @brief    This union group all the registers having a bit-field
+  *           description.
+  *           This union is useful but it's not needed by the driver.
+  *
+  *           REMOVING this union you are compliant with:
+  *           MISRA-C 2012 [Rule 19.2] -> " Union are not allowed "
+  *
+  * @{
+  *
+  */
+
+typedef union
+{
+  i3g4250d_ctrl_reg1_t        ctrl_reg1;
+  i3g4250d_ctrl_reg2_t        ctrl_reg2;
+  i3g4250d_ctrl_reg3_t        ctrl_reg3;
+  i3g4250d_ctrl_reg4_t        ctrl_reg4;
+  i3g4250d_ctrl_reg5_t        ctrl_reg5;
+  i3g4250d_reference_t        reference;
+  i3g4250d_status_reg_t       status_reg;
+  i3g4250d_fifo_ctrl_reg_t    fifo_ctrl_reg;
+  i3g4250d_fifo_src_reg_t     fifo_src_reg;
+  i3g4250d_int1_cfg_t         int1_cfg;
+  i3g4250d_int1_src_t         int1_src;
+  i3g4250d_int1_tsh_xh_t      int1_tsh_xh;
+  i3g4250d_int1_tsh_xl_t      int1_tsh_xl;
+  i3g4250d_int1_tsh_yh_t      int1_tsh_yh;
+  i3g4250d_int1_tsh_yl_t      int1_tsh_yl;
+  i3g4250d_int1_tsh_zh_t      int1_tsh_zh;
+  i3g4250d_int1_tsh_zl_t      int1_tsh_zl;
+  i3g4250d_int1_duration_t    int1_duration;
+  bitwise_t                   bitwise;
+  uint8_t                     byte;
+} i3g4250d_reg_t;
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup i3g4250d_Private_Data
+  * @brief    Optional driver private data. When stmdev_ctx_t.priv_data
+  *           points to this structure the driver caches part of the
+  *           device configuration in it, so that the data path doesn't
+  *           need to re-read the control registers.
+  *           The structure must be zero-initialized before use, that
+  *           matches the device configuration after power-up.
+  *
+  * @{
+  *
+  */
+
+typedef int32_t (*i3g4250d_bus_recover_ptr)(void *handle);
+
+typedef struct
+{
+  i3g4250d_bus_recover_ptr recover; /* stuck bus recovery, can be NULL */
+  uint16_t budget;            /* retries available in a burst of errors */
+  uint8_t retries;            /* retries per transaction */
+  uint8_t backoff_ms;         /* first retry delay, doubled each retry */
+} i3g4250d_bus_retry_t;
+
+typedef struct
+{
+  uint32_t errors;            /* failed attempts */
+  uint32_t retried;           /* transactions completed by a retry */
+  uint32_t recovered;         /* transactions completed after recovery */
+  uint32_t failed;            /* transactions reported as failed */
+  uint32_t unrecoverable;     /* failed reads with side effects, not retried */
+} i3g4250d_bus_stats_t;
+
+#define I3G4250D_LOCK_BUS                0xFFU
+typedef void (*i3g4250d_lock_ptr)(void *handle, uint8_t id);
+
+typedef struct
+{
+  i3g4250d_lock_ptr lock;
+  i3g4250d_lock_ptr unlock;
+  void *handle;
+} i3g4250d_lock_t;
+
+typedef struct
+{
+  i3g4250d_bus_retry_t retry;
+  i3g4250d_bus_stats_t stats;
+  i3g4250d_lock_t lock;
+  uint16_t tokens;            /* retry budget left */
+  volatile uint32_t seq;      /* odd while the shadow is updated */
+  volatile uint8_t ctrl_reg[5]; /* CTRL_REG1..5 shadow */
+  volatile uint8_t ctrl_valid;  /* valid shadow bytes, bit 0: CTRL_REG1 */
+  volatile uint8_t ble;       /* cached CTRL_REG4.ble (i3g4250d_ble_t) */
+  uint8_t bus;                /* i3g4250d_bus_t */
+} i3g4250d_priv_t;
+
+/**
+  * @}
+  *
+  */
+
+#ifndef __weak
+#define __weak __attribute__((weak))
+#endif /* __weak */
+
+/*
+ * These are the basic platform dependent I/O routines to read
+ * and write device registers connected on a standard bus.
+ * The driver keeps offering a default implementation based on function
+ * pointers to read/write routines for backward compatibility.
+ * The __weak directive allows the final application to overwrite
+ * them with a custom implementation.
+ */
+
+int32_t i3g4250d_read_reg(const stmdev_ctx_t *ctx, uint8_t reg,
+                          uint8_t *data,
+                          uint16_t len);
+int32_t i3g4250d_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
+                           uint8_t *data,
+                           uint16_t len);
+
+float_t i3g4250d_from_fs245dps_to_mdps(int16_t lsb);
+float_t i3g4250d_from_fs500dps_to_mdps(int16_t lsb);
+float_t i3g4250d_from_fs2000dps_to_mdps(int16_t lsb);
+float_t i3g4250d_from_lsb_to_celsius(int16_t lsb);
+
+int32_t i3g4250d_axis_x_data_set(const stmdev_ctx_t *ctx, uint8_t val);
+int32_t i3g4250d_axis_x_data_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+int32_t i3g4250d_axis_y_data_set(const stmdev_ctx_t *ctx, uint8_t val);
+int32_t i3g4250d_axis_y_data_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+int32_t i3g4250d_axis_z_data_set(const stmdev_ctx_t *ctx, uint8_t val);
+int32_t i3g4250d_axis_z_data_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+typedef enum
+{
+  I3G4250D_ODR_OFF     = 0x00,
+  I3G4250D_ODR_SLEEP   = 0x08,
+  I3G4250D_ODR_100Hz   = 0x0F,
+  I3G4250D_ODR_200Hz   = 0x1F,
+  I3G4250D_ODR_400Hz   = 0x2F,
+  I3G4250D_ODR_800Hz   = 0x3F,
+} i3g4250d_dr_t;
+int32_t i3g4250d_data_rate_set(const stmdev_ctx_t *ctx, i3g4250d_dr_t val);
+int32_t i3g4250d_data_rate_get(const stmdev_ctx_t *ctx, i3g4250d_dr_t *val);
+int32_t i3g4250d_data_rate_hz_get(const stmdev_ctx_t *ctx, float_t *val);
+
+typedef enum
+{
+  I3G4250D_245dps     = 0x00,
+  I3G4250D_500dps     = 0x01,
+  I3G4250D_2000dps    = 0x02,
+} i3g4250d_fs_t;
+int32_t i3g4250d_full_scale_set(const stmdev_ctx_t *ctx, i3g4250d_fs_t val);
+int32_t i3g4250d_full_scale_get(const stmdev_ctx_t *ctx,
+                                i3g4250d_fs_t *val);
+
+int32_t i3g4250d_status_reg_get(const stmdev_ctx_t *ctx,
+                                i3g4250d_status_reg_t *val);
+
+int32_t i3g4250d_flag_data_ready_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+int32_t i3g4250d_temperature_raw_get(const stmdev_ctx_t *ctx,
+                                     uint8_t *buff);
+
+int32_t i3g4250d_angular_rate_raw_get(const stmdev_ctx_t *ctx,
+                                      int16_t *val);
+
+int32_t i3g4250d_device_id_get(const stmdev_ctx_t *ctx, uint8_t *buff);
+
+typedef enum
+{
+  I3G4250D_GY_ST_DISABLE    = 0,
+  I3G4250D_GY_ST_POSITIVE   = 1,
+  I3G4250D_GY_ST_NEGATIVE   = 3,
+} i3g4250d_st_t;
+int32_t i3g4250d_self_test_set(const stmdev_ctx_t *ctx, i3g4250d_st_t val);
+int32_t i3g4250d_self_test_get(const stmdev_ctx_t *ctx, i3g4250d_st_t *val);
+
+typedef enum
+{
+  I3G4250D_AUX_LSB_AT_LOW_ADD   = 0,
+  I3G4250D_AUX_MSB_AT_LOW_ADD   = 1,
+} i3g4250d_ble_t;
+int32_t i3g4250d_data_format_set(const stmdev_ctx_t *ctx,
+                                 i3g4250d_ble_t val);
+int32_t i3g4250d_data_format_get(const stmdev_ctx_t *ctx,
+                                 i3g4250d_ble_t *val);
+
+int32_t i3g4250d_boot_set(const stmdev_ctx_t *ctx, uint8_t val);
+int32_t i3g4250d_boot_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+typedef enum
+{
+  I3G4250D_CUT_OFF_LOW        = 0,
+  I3G4250D_CUT_OFF_MEDIUM     = 1,
+  I3G4250D_CUT_OFF_HIGH       = 2,
+  I3G4250D_CUT_OFF_VERY_HIGH  = 3,
+} i3g4250d_bw_t;
+int32_t i3g4250d_lp_bandwidth_set(const stmdev_ctx_t *ctx,
+                                  i3g4250d_bw_t val);
+int32_t i3g4250d_lp_bandwidth_get(const stmdev_ctx_t *ctx,
+                                  i3g4250d_bw_t *val);
+
+typedef enum
+{
+  I3G4250D_HP_LEVEL_0   = 0,
+  I3G4250D_HP_LEVEL_1   = 1,
+  I3G4250D_HP_LEVEL_2   = 2,
+  I3G4250D_HP_LEVEL_3   = 3,
+  I3G4250D_HP_LEVEL_4   = 4,
+  I3G4250D_HP_LEVEL_5   = 5,
+  I3G4250D_HP_LEVEL_6   = 6,
+  I3G4250D_HP_LEVEL_7   = 7,
+  I3G4250D_HP_LEVEL_8   = 8,
+  I3G4250D_HP_LEVEL_9   = 9,
+} i3g4250d_hpcf_t;
+int32_t i3g4250d_hp_bandwidth_set(const stmdev_ctx_t *ctx,
+                                  i3g4250d_hpcf_t val);
+int32_t i3g4250d_hp_bandwidth_get(const stmdev_ctx_t *ctx,
+                                  i3g4250d_hpcf_t *val);
+
+typedef enum
+{
+  I3G4250D_HP_NORMAL_MODE_WITH_RST  = 0,
+  I3G4250D_HP_REFERENCE_SIGNAL      = 1,
+  I3G4250D_HP_NORMAL_MODE           = 2,
+  I3G4250D_HP_AUTO_RESET_ON_INT     = 3,
+} i3g4250d_hpm_t;
+int32_t i3g4250d_hp_mode_set(const stmdev_ctx_t *ctx, i3g4250d_hpm_t val);
+int32_t i3g4250d_hp_mode_get(const stmdev_ctx_t *ctx, i3g4250d_hpm_t *val);
+
+typedef enum
+{
+  I3G4250D_ONLY_LPF1_ON_OUT     = 0,
+  I3G4250D_LPF1_HP_ON_OUT       = 1,
+  I3G4250D_LPF1_LPF2_ON_OUT     = 2,
+  I3G4250D_LPF1_HP_LPF2_ON_OUT  = 6,
+} i3g4250d_out_sel_t;
+int32_t i3g4250d_filter_path_set(const stmdev_ctx_t *ctx,
+                                 i3g4250d_out_sel_t val);
+int32_t i3g4250d_filter_path_get(const stmdev_ctx_t *ctx,
+                                 i3g4250d_out_sel_t *val);
+
+typedef enum
+{
+  I3G4250D_ONLY_LPF1_ON_INT     = 0,
+  I3G4250D_LPF1_HP_ON_INT       = 1,
+  I3G4250D_LPF1_LPF2_ON_INT     = 2,
+  I3G4250D_LPF1_HP_LPF2_ON_INT  = 6,
+} i3g4250d_int1_sel_t;
+int32_t i3g4250d_filter_path_internal_set(const stmdev_ctx_t *ctx,
+                                          i3g4250d_int1_sel_t val);
+int32_t i3g4250d_filter_path_internal_get(const stmdev_ctx_t *ctx,
+                                          i3g4250d_int1_sel_t *val);
+
+int32_t i3g4250d_hp_reference_value_set(const stmdev_ctx_t *ctx,
+                                        uint8_t val);
+int32_t i3g4250d_hp_reference_value_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val);
+
+typedef enum
+{
+  I3G4250D_SPI_4_WIRE  = 0,
+  I3G4250D_SPI_3_WIRE  = 1,
+} i3g4250d_sim_t;
+int32_t i3g4250d_spi_mode_set(const stmdev_ctx_t *ctx, i3g4250d_sim_t val);
+int32_t i3g4250d_spi_mode_get(const stmdev_ctx_t *ctx, i3g4250d_sim_t *val);
+
+/** Multi-byte auto-increment bit of the sub-address **/
+#define I3G4250D_I2C_AUTO_INCREMENT      0x80U
+#define I3G4250D_SPI_AUTO_INCREMENT      0x40U
+
+typedef enum
+{
+  I3G4250D_BUS_USER  = 0, /* auto-increment managed by platform functions */
+  I3G4250D_BUS_I2C   = 1,
+  I3G4250D_BUS_SPI   = 2,
+} i3g4250d_bus_t;
+int32_t i3g4250d_bus_mode_set(const stmdev_ctx_t *ctx, i3g4250d_bus_t val);
+int32_t i3g4250d_bus_mode_get(const stmdev_ctx_t *ctx, i3g4250d_bus_t *val);
+
+int32_t i3g4250d_bus_burst_check(const stmdev_ctx_t *ctx, uint8_t *val);
+int32_t i3g4250d_bus_retry_set(const stmdev_ctx_t *ctx,
+                               const i3g4250d_bus_retry_t *val);
+int32_t i3g4250d_bus_retry_get(const stmdev_ctx_t *ctx,
+                               i3g4250d_bus_retry_t *val);
+int32_t i3g4250d_bus_stats_get(const stmdev_ctx_t *ctx,
+                               i3g4250d_bus_stats_t *val);
+int32_t i3g4250d_lock_set(const stmdev_ctx_t *ctx, const i3g4250d_lock_t *val);
+int32_t i3g4250d_ctrl_reg_cached_get(const stmdev_ctx_t *ctx, uint8_t reg,
+                                     uint8_t *val);
+
+typedef struct
+{
+  uint8_t i1_int1             : 1;
+  uint8_t i1_boot             : 1;
+} i3g4250d_int1_route_t;
+int32_t i3g4250d_pin_int1_route_set(const stmdev_ctx_t *ctx,
+                                    i3g4250d_int1_route_t val);
+int32_t i3g4250d_pin_int1_route_get(const stmdev_ctx_t *ctx,
+                                    i3g4250d_int1_route_t *val);
+
+typedef struct
+{
+  uint8_t i2_empty             : 1;
+  uint8_t i2_orun              : 1;
+  uint8_t i2_wtm               : 1;
+  uint8_t i2_drdy              : 1;
+} i3g4250d_int2_route_t;
+int32_t i3g4250d_pin_int2_route_set(const stmdev_ctx_t *ctx,
+                                    i3g4250d_int2_route_t val);
+int32_t i3g4250d_pin_int2_route_get(const stmdev_ctx_t *ctx,
+                                    i3g4250d_int2_route_t *val);
+
+typedef enum
+{
+  I3G4250D_PUSH_PULL   = 0,
+  I3G4250D_OPEN_DRAIN  = 1,
+} i3g4250d_pp_od_t;
+int32_t i3g4250d_pin_mode_set(const stmdev_ctx_t *ctx,
+                              i3g4250d_pp_od_t val);
+int32_t i3g4250d_pin_mode_get(const stmdev_ctx_t *ctx,
+                              i3g4250d_pp_od_t *val);
+
+typedef enum
+{
+  I3G4250D_ACTIVE_HIGH  = 0,
+  I3G4250D_ACTIVE_LOW   = 1,
+} i3g4250d_h_lactive_t;
+int32_t i3g4250d_pin_polarity_set(const stmdev_ctx_t *ctx,
+                                  i3g4250d_h_lactive_t val);
+int32_t i3g4250d_pin_polarity_get(const stmdev_ctx_t *ctx,
+                                  i3g4250d_h_lactive_t *val);
+
+typedef enum
+{
+  I3G4250D_INT_PULSED   = 0,
+  I3G4250D_INT_LATCHED  = 1,
+} i3g4250d_lir_t;
+int32_t i3g4250d_int_notification_set(const stmdev_ctx_t *ctx,
+                                      i3g4250d_lir_t val);
+int32_t i3g4250d_int_notification_get(const stmdev_ctx_t *ctx,
+                                      i3g4250d_lir_t *val);
+
+int32_t i3g4250d_int_on_threshold_conf_set(const stmdev_ctx_t *ctx,
+                                           i3g4250d_int1_cfg_t *val);
+int32_t i3g4250d_int_on_threshold_conf_get(const stmdev_ctx_t *ctx,
+                                           i3g4250d_int1_cfg_t *val);
+
+typedef enum
+{
+  I3G4250D_INT1_ON_TH_AND  = 1,
+  I3G4250D_INT1_ON_TH_OR   = 0,
+} i3g4250d_and_or_t;
+int32_t i3g4250d_int_on_threshold_mode_set(const stmdev_ctx_t *ctx,
+                                           i3g4250d_and_or_t val);
+int32_t i3g4250d_int_on_threshold_mode_get(const stmdev_ctx_t *ctx,
+                                           i3g4250d_and_or_t *val);
+
+int32_t i3g4250d_int_on_threshold_src_get(const stmdev_ctx_t *ctx,
+                                          i3g4250d_int1_src_t *val);
+
+int32_t i3g4250d_int_x_threshold_set(const stmdev_ctx_t *ctx, uint16_t val);
+int32_t i3g4250d_int_x_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val);
+
+int32_t i3g4250d_int_y_threshold_set(const stmdev_ctx_t *ctx, uint16_t val);
+int32_t i3g4250d_int_y_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val);
+
+int32_t i3g4250d_int_z_threshold_set(const stmdev_ctx_t *ctx, uint16_t val);
+int32_t i3g4250d_int_z_threshold_get(const stmdev_ctx_t *ctx, uint16_t *val);
+
+int32_t i3g4250d_int_on_threshold_dur_set(const stmdev_ctx_t *ctx,
+                                          uint8_t val);
+int32_t i3g4250d_int_on_threshold_dur_get(const stmdev_ctx_t *ctx,
+                                          uint8_t *val);
+
+typedef struct
+{
+  i3g4250d_int1_cfg_t cfg;    /* INT1_CFG: axis enable, latch, AND/OR */
+  float_t x_dps;
+  float_t y_dps;
+  float_t z_dps;
+  float_t duration_ms;
+  uint8_t wait;               /* INT1_DURATION.wait: deassert after it */
+} i3g4250d_int1_phys_t;
+int32_t i3g4250d_int_on_threshold_phys_set(const stmdev_ctx_t *ctx,
+                                           const i3g4250d_int1_phys_t *val);
+int32_t i3g4250d_int_on_threshold_phys_get(const stmdev_ctx_t *ctx,
+                                           i3g4250d_int1_phys_t *val);
+
+int32_t i3g4250d_fifo_enable_set(const stmdev_ctx_t *ctx, uint8_t val);
+int32_t i3g4250d_fifo_enable_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+int32_t i3g4250d_fifo_watermark_set(const stmdev_ctx_t *ctx, uint8_t val);
+int32_t i3g4250d_fifo_watermark_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+typedef enum
+{
+  I3G4250D_FIFO_BYPASS_MODE     = 0x00,
+  I3G4250D_FIFO_MODE            = 0x01,
+  I3G4250D_FIFO_STREAM_MODE     = 0x02,
+} i3g4250d_fifo_mode_t;
+int32_t i3g4250d_fifo_mode_set(const stmdev_ctx_t *ctx,
+                               i3g4250d_fifo_mode_t val);
+int32_t i3g4250d_fifo_mode_get(const stmdev_ctx_t *ctx,
+                               i3g4250d_fifo_mode_t *val);
+
+int32_t i3g4250d_fifo_data_level_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+int32_t i3g4250d_fifo_empty_flag_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+int32_t i3g4250d_fifo_ovr_flag_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+int32_t i3g4250d_fifo_wtm_flag_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+#define I3G4250D_FIFO_DEPTH              32U
+int32_t i3g4250d_fifo_angular_rate_raw_get(const stmdev_ctx_t *ctx,
+                                           int16_t *val, uint8_t num);
+int32_t i3g4250d_fifo_drain(const stmdev_ctx_t *ctx, int16_t *val,
+                            uint8_t max, uint8_t *num);
+
+/* lane alignment of i3g4250d_fifo_soa_t, up to 64 (the size of a lane) */
+#ifndef I3G4250D_SOA_ALIGN
+#define I3G4250D_SOA_ALIGN               16
+#endif /* I3G4250D_SOA_ALIGN */
+#ifndef I3G4250D_ALIGNED
+#if defined(__GNUC__)
+#define I3G4250D_ALIGNED(n)              __attribute__((aligned(n)))
+#else
+#define I3G4250D_ALIGNED(n)
+#endif /* __GNUC__ */
+#endif /* I3G4250D_ALIGNED */
+/* 1: in-register deinterleave with vector shuffles, 0: scalar */
+#ifndef I3G4250D_SOA_SIMD
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_shufflevector)
+#define I3G4250D_SOA_SIMD                1
+#endif /* __builtin_shufflevector */
+#endif /* __has_builtin */
+#endif /* I3G4250D_SOA_SIMD */
+#ifndef I3G4250D_SOA_SIMD
+#define I3G4250D_SOA_SIMD                0
+#endif /* I3G4250D_SOA_SIMD */
+typedef struct
+{
+  int16_t x[I3G4250D_FIFO_DEPTH];
+  int16_t y[I3G4250D_FIFO_DEPTH];
+  int16_t z[I3G4250D_FIFO_DEPTH];
+} I3G4250D_ALIGNED(I3G4250D_SOA_ALIGN) i3g4250d_fifo_soa_t;
+int32_t i3g4250d_fifo_angular_rate_raw_soa_get(const stmdev_ctx_t *ctx,
+                                               i3g4250d_fifo_soa_t *val,
+                                               uint8_t num);
+int32_t i3g4250d_fifo_drain_soa(const stmdev_ctx_t *ctx,
+                                i3g4250d_fifo_soa_t *val, uint8_t max,
+                                uint8_t *num);
+
+typedef struct
+{
+  float_t up_rms;             /* activity [LSB] selecting 800 Hz */
+  float_t down_rms;           /* activity [LSB] of a quiet block */
+  uint16_t hold;              /* quiet blocks before stepping down */
+  i3g4250d_dr_t min_odr;      /* lowest rate, 100Hz to ODR_SLEEP */
+} i3g4250d_odr_gov_cfg_t;
+
+typedef struct
+{
+  i3g4250d_odr_gov_cfg_t cfg;
+  uint64_t ts_us;             /* timestamp of the next sample */
+  uint32_t seq;               /* sequence number of the next sample */
+  uint32_t pending_period_us;
+  int16_t last[3];
+  uint16_t quiet;
+  uint8_t pending;            /* FIFO samples at the previous rate */
+  uint8_t axes;               /* xen yen zen restored out of sleep */
+  uint8_t level;
+  uint8_t min_level;
+  uint8_t primed;
+} i3g4250d_odr_gov_t;
+int32_t i3g4250d_odr_governor_init(const stmdev_ctx_t *ctx,
+                                   i3g4250d_odr_gov_t *gov,
+                                   const i3g4250d_odr_gov_cfg_t *cfg,
+                                   uint64_t ts_us);
+int32_t i3g4250d_odr_governor_update(const stmdev_ctx_t *ctx,
+                                     i3g4250d_odr_gov_t *gov,
+                                     const int16_t *val, uint16_t num,
+                                     uint32_t *seq, uint64_t *ts_us);
+int32_t i3g4250d_odr_governor_wakeup(const stmdev_ctx_t *ctx,
+                                     i3g4250d_odr_gov_t *gov,
+                                     uint64_t ts_us);
+i3g4250d_dr_t i3g4250d_odr_governor_rate_get(const i3g4250d_odr_gov_t *gov);
+
+typedef enum
+{
+  I3G4250D_CAPTURE_IDLE       = 0,
+  I3G4250D_CAPTURE_ARMED      = 1,
+  I3G4250D_CAPTURE_TRIGGERED  = 2,
+  I3G4250D_CAPTURE_DONE       = 3,
+} i3g4250d_capture_state_t;
+
+typedef struct
+{
+  int16_t post[I3G4250D_FIFO_DEPTH][3];
+  int16_t *ring;              /* pre-trigger ring, X Y Z interleaved */
+  uint16_t pre_len;
+  uint16_t head;
+  uint16_t count;
+  uint16_t overruns;          /* re-arms after a FIFO overrun */
+  uint8_t state;
+} i3g4250d_capture_t;
+void i3g4250d_capture_init(i3g4250d_capture_t *cap, int16_t *ring,
+                           uint16_t pre_len);
+int32_t i3g4250d_capture_arm(const stmdev_ctx_t *ctx,
+                             i3g4250d_capture_t *cap);
+int32_t i3g4250d_capture_poll(const stmdev_ctx_t *ctx,
+                              i3g4250d_capture_t *cap,
+                              i3g4250d_capture_state_t *val);
+int32_t i3g4250d_capture_get(const i3g4250d_capture_t *cap, int16_t *val,
+                             uint16_t *pre_num);
+
+#define I3G4250D_REC_MAGIC               0x52473349U /* "I3GR" */
+#define I3G4250D_REC_VERSION             1U
+#define I3G4250D_REC_HEADER_SIZE         16U
+#define I3G4250D_REC_BLOCK_HEADER_SIZE   16U
+#define I3G4250D_REC_BLOCK_SIZE(num) \
+  ((I3G4250D_REC_BLOCK_HEADER_SIZE + ((uint32_t)(num) * 6U) + 7U) & ~7U)
+
+typedef struct
+{
+  uint16_t version;
+  uint16_t block_len;         /* maximum number of samples per block */
+  uint8_t ctrl_reg[5];        /* CTRL_REG1 to CTRL_REG5 */
+  uint8_t fifo_ctrl;          /* FIFO_CTRL_REG */
+} i3g4250d_rec_header_t;
+
+typedef struct
+{
+  uint64_t ts_us;             /* timestamp of the first sample */
+  uint32_t seq;               /* sequence number of the first sample */
+  uint16_t num;               /* number of samples */
+} i3g4250d_rec_block_t;
+
+typedef int32_t (*i3g4250d_rec_flush_t)(void *handle, const uint8_t *buf,
+                                        uint32_t len);
+typedef struct
+{
+  i3g4250d_rec_flush_t flush;
+  void *handle;
+  uint8_t *buf;
+  uint32_t size;
+  uint32_t used;
+  uint16_t block_len;
+} i3g4250d_rec_writer_t;
+int32_t i3g4250d_rec_header_get(const stmdev_ctx_t *ctx, uint16_t block_len,
+                                i3g4250d_rec_header_t *val);
+int32_t i3g4250d_rec_writer_init(i3g4250d_rec_writer_t *w, uint8_t *buf,
+                                 uint32_t size, i3g4250d_rec_flush_t flush,
+                                 void *handle,
+                                 const i3g4250d_rec_header_t *hdr);
+int32_t i3g4250d_rec_writer_flush(i3g4250d_rec_writer_t *w);
+int32_t i3g4250d_rec_write(i3g4250d_rec_writer_t *w, const int16_t *val,
+                           uint16_t num, uint32_t seq, uint64_t ts_us);
+int32_t i3g4250d_rec_header_parse(const uint8_t *data, uint32_t len,
+                                  i3g4250d_rec_header_t *val);
+int32_t i3g4250d_rec_block_next(const uint8_t *data, uint32_t len,
+                                uint32_t *offset, i3g4250d_rec_block_t *blk,
+                                const int16_t **val);
+
+typedef uint64_t (*i3g4250d_replay_clock_t)(void);
+typedef struct
+{
+  i3g4250d_rec_block_t blk;
+  const int16_t *val;
+  uint32_t offset;            /* offset of the next block */
+  uint16_t idx;               /* sample index in blk */
+} i3g4250d_replay_cursor_t;
+
+typedef struct
+{
+  i3g4250d_replay_cursor_t cur;
+  i3g4250d_replay_clock_t now_us;
+  const uint8_t *data;
+  uint64_t t0_us;
+  uint64_t ts0_us;
+  uint32_t len;
+  uint32_t period_us;
+  uint32_t seq;               /* number of samples served */
+  uint32_t fault_period;      /* injected fault every n transactions */
+  uint32_t xfer;              /* transactions since the last fault */
+  uint8_t regs[0x40];
+  uint8_t out[6];
+  uint8_t started;
+  uint8_t eof;
+} i3g4250d_replay_t;
+int32_t i3g4250d_replay_init(i3g4250d_replay_t *rp, const uint8_t *data,
+                             uint32_t len, i3g4250d_replay_clock_t now_us);
+int32_t i3g4250d_replay_read(void *handle, uint8_t reg, uint8_t *buf,
+                             uint16_t len);
+int32_t i3g4250d_replay_write(void *handle, uint8_t reg, const uint8_t *buf,
+                              uint16_t len);
+uint8_t i3g4250d_replay_eof_get(const i3g4250d_replay_t *rp);
+void i3g4250d_replay_fault_set(i3g4250d_replay_t *rp, uint32_t period);
+
+typedef struct
+{
+  uint16_t up_lsb;            /* |raw| stepping the full scale up */
+  uint16_t down_lsb;          /* peak [LSB of the lower scale] to step down */
+  uint16_t hold;              /* quiet blocks before stepping down */
+} i3g4250d_autorange_cfg_t;
+
+typedef struct
+{
+  i3g4250d_autorange_cfg_t cfg;
+  uint64_t pending_fs;        /* 2-bit full scale per pending sample */
+  uint16_t quiet;
+  uint8_t pending;            /* FIFO samples at previous full scales */
+  uint8_t fs;
+} i3g4250d_autorange_t;
+int32_t i3g4250d_autorange_init(const stmdev_ctx_t *ctx,
+                                i3g4250d_autorange_t *ar,
+                                const i3g4250d_autorange_cfg_t *cfg,
+                                i3g4250d_fs_t fs);
+int32_t i3g4250d_autorange_update(const stmdev_ctx_t *ctx,
+                                  i3g4250d_autorange_t *ar,
+                                  const int16_t *val, uint16_t num,
+                                  i3g4250d_fs_t *fs);
+i3g4250d_fs_t i3g4250d_autorange_fs_get(const i3g4250d_autorange_t *ar);
+void i3g4250d_autorange_to_mdps(const int16_t *val, const i3g4250d_fs_t *fs,
+                                uint16_t num, float_t *out);
+
+typedef void (*i3g4250d_async_done_t)(void *arg, int32_t status);
+typedef int32_t (*i3g4250d_async_xfer_ptr)(void *handle, uint8_t reg,
+                                           uint8_t *buf, uint16_t len,
+                                           i3g4250d_async_done_t done,
+                                           void *arg);
+typedef struct
+{
+  i3g4250d_async_xfer_ptr read;
+  i3g4250d_async_xfer_ptr write;
+  void *handle;
+} i3g4250d_async_if_t;
+
+typedef struct
+{
+  const stmdev_ctx_t *ctx;
+  const i3g4250d_async_if_t *bus;
+  i3g4250d_async_done_t done;
+  void *arg;
+  int16_t *val;
+  int32_t status;             /* completion status */
+  uint8_t max;
+  uint8_t num;                /* samples read, valid at completion */
+  uint8_t src;                /* FIFO_SRC_REG */
+} i3g4250d_fifo_drain_op_t;
+int32_t i3g4250d_read_reg_async(const stmdev_ctx_t *ctx,
+                                const i3g4250d_async_if_t *bus, uint8_t reg,
+                                uint8_t *data, uint16_t len,
+                                i3g4250d_async_done_t done, void *arg);
+int32_t i3g4250d_write_reg_async(const stmdev_ctx_t *ctx,
+                                 const i3g4250d_async_if_t *bus, uint8_t reg,
+                                 uint8_t *data, uint16_t len,
+                                 i3g4250d_async_done_t done, void *arg);
+int32_t i3g4250d_fifo_drain_async(i3g4250d_fifo_drain_op_t *op,
+                                  const stmdev_ctx_t *ctx,
+                                  const i3g4250d_async_if_t *bus,
+                                  int16_t *val, uint8_t max,
+                                  i3g4250d_async_done_t done, void *arg);
+
+typedef struct
+{
+  const stmdev_ctx_t *ctx;
+  const i3g4250d_async_if_t *bus;
+  i3g4250d_async_done_t done;
+  void *arg;
+  int32_t status;             /* completion status */
+  uint8_t reg;
+  uint8_t mask;
+  uint8_t val;
+  uint8_t data;               /* register content, valid at completion */
+} i3g4250d_modify_op_t;
+int32_t i3g4250d_modify_reg_async(i3g4250d_modify_op_t *op,
+                                  const stmdev_ctx_t *ctx,
+                                  const i3g4250d_async_if_t *bus, uint8_t reg,
+                                  uint8_t mask, uint8_t val,
+                                  i3g4250d_async_done_t done, void *arg);
+
+typedef struct
+{
+  const stmdev_ctx_t *ctx;
+  i3g4250d_async_done_t done;
+  void *arg;
+  int32_t status;
+  uint8_t pending;
+} i3g4250d_async_sim_t;
+void i3g4250d_async_sim_init(i3g4250d_async_sim_t *sim,
+                             const stmdev_ctx_t *ctx,
+                             i3g4250d_async_if_t *bus);
+int32_t i3g4250d_async_sim_read(void *handle, uint8_t reg, uint8_t *buf,
+                                uint16_t len, i3g4250d_async_done_t done,
+                                void *arg);
+int32_t i3g4250d_async_sim_write(void *handle, uint8_t reg, uint8_t *buf,
+                                 uint16_t len, i3g4250d_async_done_t done,
+                                 void *arg);
+uint8_t i3g4250d_async_sim_poll(i3g4250d_async_sim_t *sim);
+
+typedef struct
+{
+  uint64_t last_us;           /* estimated time of the last sample */
+  uint64_t next_us;           /* next poll time */
+  uint64_t bracket_us;        /* last sample found after a miss, time */
+  uint32_t period_q4;         /* learned sample period [us / 16] */
+  uint32_t guard_us;
+  uint32_t polls;             /* polls done */
+  uint32_t misses;            /* polls finding no new sample */
+  uint32_t samples;           /* samples read */
+  uint32_t bracket_n;         /* ... and value of "samples" */
+  uint8_t missed;             /* current sample already missed once */
+  uint8_t bracketed;          /* bracket_us valid */
+} i3g4250d_drdy_sched_t;
+int32_t i3g4250d_drdy_sched_init(const stmdev_ctx_t *ctx,
+                                 i3g4250d_drdy_sched_t *sch, uint64_t now_us);
+int32_t i3g4250d_drdy_sched_poll(const stmdev_ctx_t *ctx,
+                                 i3g4250d_drdy_sched_t *sch, uint64_t now_us,
+                                 int16_t *val, uint8_t *ready);
+uint64_t i3g4250d_drdy_sched_next_get(const i3g4250d_drdy_sched_t *sch);
+float_t i3g4250d_drdy_sched_period_get(const i3g4250d_drdy_sched_t *sch);
+
+typedef enum
+{
+  I3G4250D_STAGE_IRQ          = 0,
+  I3G4250D_STAGE_DRAIN_START  = 1,
+  I3G4250D_STAGE_DRAIN_END    = 2,
+  I3G4250D_STAGE_DECODE       = 3,
+  I3G4250D_STAGE_ENQUEUE      = 4,
+  I3G4250D_STAGE_DEQUEUE      = 5,
+  I3G4250D_STAGE_NUM          = 6,
+} i3g4250d_lat_stage_t;
+
+#define I3G4250D_LAT_BINS                124U
+typedef uint32_t (*i3g4250d_lat_clock_t)(void);
+typedef struct
+{
+  i3g4250d_lat_clock_t now;
+  uint32_t ts[I3G4250D_STAGE_NUM];
+  uint32_t hist[I3G4250D_STAGE_NUM][I3G4250D_LAT_BINS];
+  uint32_t max[I3G4250D_STAGE_NUM];
+  uint32_t count;             /* batches recorded */
+} i3g4250d_lat_t;
+void i3g4250d_lat_init(i3g4250d_lat_t *lat, i3g4250d_lat_clock_t now);
+void i3g4250d_lat_record(i3g4250d_lat_t *lat, const uint32_t *ts);
+void i3g4250d_lat_mark(i3g4250d_lat_t *lat, i3g4250d_lat_stage_t stage);
+int32_t i3g4250d_lat_percentile_get(const i3g4250d_lat_t *lat,
+                                    i3g4250d_lat_stage_t stage, float_t pct,
+                                    uint32_t *val);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_REGS_H */
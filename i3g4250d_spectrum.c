@@ -0,0 +1,391 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_spectrum.c
+  * @author  Sensors Software Solution Team
+  * @brief   Optional spectral analysis of the i3g4250d driver: averaged
+  *          periodogram (Welch) of each axis.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_spectrum.h"
+#include <string.h>
+
+#define I3G4250D_PI                      3.14159265f
+
+/**
+  * @addtogroup  I3G4250D
+  * @{
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_spectrum
+  * @brief      This section groups the vibration spectrum analyzer. Each
+  *             axis is split in Hann-windowed segments of
+  *             I3G4250D_SPECTRUM_LEN samples with 50% overlap, and the
+  *             one-sided power spectral densities of the segments are
+  *             averaged (Welch method). The real FFT is computed as a
+  *             complex FFT of half size on the even / odd samples, with
+  *             twiddles precomputed at init; no memory is allocated.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Spectrum analyzer initialization at the data rate currently
+  *         set in the device.
+  *
+  * @param  ctx   Read / write interface definitions.(ptr)
+  * @param  sp    Spectrum analyzer instance.(ptr)
+  * @retval       Interface status (MANDATORY: return 0 -> no Error)
+  *               -1 also when the device doesn't generate data
+  *
+  */
+int32_t i3g4250d_spectrum_init(const stmdev_ctx_t *ctx,
+                               i3g4250d_spectrum_t *sp)
+{
+  float_t odr;
+  float_t w;
+  uint16_t n;
+  int32_t ret;
+
+  ret = i3g4250d_data_rate_hz_get(ctx, &odr);
+  if (ret != 0) { return ret; }
+
+  (void)memset(sp, 0, sizeof(i3g4250d_spectrum_t));
+  sp->odr = odr;
+  if (sp->odr == 0.0f) { return -1; }
+
+  for (n = 0U; n < I3G4250D_SPECTRUM_LEN; n++)
+  {
+    w = 0.5f - (0.5f * cosf((2.0f * I3G4250D_PI * (float_t)n) /
+                            (float_t)I3G4250D_SPECTRUM_LEN));
+    sp->window[n] = w;
+    sp->win_pow += w * w;
+  }
+
+  for (n = 0U; n < (I3G4250D_SPECTRUM_LEN / 2U); n++)
+  {
+    sp->tw_cos[n] = cosf((2.0f * I3G4250D_PI * (float_t)n) /
+                         (float_t)I3G4250D_SPECTRUM_LEN);
+    sp->tw_sin[n] = -sinf((2.0f * I3G4250D_PI * (float_t)n) /
+                          (float_t)I3G4250D_SPECTRUM_LEN);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Clear the averaged spectra.
+  *
+  * @param  sp    Spectrum analyzer instance.(ptr)
+  *
+  */
+void i3g4250d_spectrum_reset(i3g4250d_spectrum_t *sp)
+{
+  (void)memset(sp->psd, 0, sizeof(sp->psd));
+  sp->segments = 0U;
+}
+
+/**
+  * @brief  In place radix-2 complex FFT of I3G4250D_SPECTRUM_LEN / 2
+  *         points on the work buffers.
+  *
+  * @param  sp    Spectrum analyzer instance.(ptr)
+  *
+  */
+static void i3g4250d_spectrum_cfft(i3g4250d_spectrum_t *sp)
+{
+  const uint16_t half = I3G4250D_SPECTRUM_LEN / 2U;
+  float_t tr;
+  float_t ti;
+  float_t wr;
+  float_t wi;
+  uint16_t i;
+  uint16_t j = 0U;
+  uint16_t k;
+  uint16_t m;
+  uint16_t len;
+
+  for (i = 0U; i < (half - 1U); i++)
+  {
+    if (i < j)
+    {
+      tr = sp->re[i];
+      sp->re[i] = sp->re[j];
+      sp->re[j] = tr;
+      ti = sp->im[i];
+      sp->im[i] = sp->im[j];
+      sp->im[j] = ti;
+    }
+
+    m = half / 2U;
+    while ((m >= 1U) && (j >= m))
+    {
+      j -= m;
+      m /= 2U;
+    }
+    j += m;
+  }
+
+  for (len = 2U; len <= half; len *= 2U)
+  {
+    for (i = 0U; i < half; i += len)
+    {
+      for (k = 0U; k < (len / 2U); k++)
+      {
+        /* twiddle of the half-size FFT: every (2 * half / len) entry */
+        m = (uint16_t)(k * ((2U * half) / len));
+        wr = sp->tw_cos[m];
+        wi = sp->tw_sin[m];
+        j = (uint16_t)(i + k + (len / 2U));
+
+        tr = (sp->re[j] * wr) - (sp->im[j] * wi);
+        ti = (sp->re[j] * wi) + (sp->im[j] * wr);
+        sp->re[j] = sp->re[i + k] - tr;
+        sp->im[j] = sp->im[i + k] - ti;
+        sp->re[i + k] += tr;
+        sp->im[i + k] += ti;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Add the power spectral density of the buffered segment of an
+  *         axis to its average.
+  *
+  * @param  sp    Spectrum analyzer instance.(ptr)
+  * @param  a     Axis
+  *
+  */
+static void i3g4250d_spectrum_segment(i3g4250d_spectrum_t *sp, uint8_t a)
+{
+  const uint16_t half = I3G4250D_SPECTRUM_LEN / 2U;
+  float_t mean = 0.0f;
+  float_t scale;
+  float_t er;
+  float_t ei;
+  float_t or_;
+  float_t oi;
+  float_t xr;
+  float_t xi;
+  uint16_t n;
+  uint16_t k;
+  uint16_t nk;
+
+  for (n = 0U; n < I3G4250D_SPECTRUM_LEN; n++)
+  {
+    mean += (float_t)sp->buf[a][n];
+  }
+  mean /= (float_t)I3G4250D_SPECTRUM_LEN;
+
+  for (n = 0U; n < half; n++)
+  {
+    sp->re[n] = ((float_t)sp->buf[a][2U * n] - mean) * sp->window[2U * n];
+    sp->im[n] = ((float_t)sp->buf[a][(2U * n) + 1U] - mean) *
+                sp->window[(2U * n) + 1U];
+  }
+
+  i3g4250d_spectrum_cfft(sp);
+
+  scale = 1.0f / (sp->odr * sp->win_pow);
+
+  for (k = 0U; k <= half; k++)
+  {
+    n = (k == half) ? 0U : k;
+    nk = (k == 0U) ? 0U : (uint16_t)(half - k);
+
+    /* split the even / odd spectra */
+    er = 0.5f * (sp->re[n] + sp->re[nk]);
+    ei = 0.5f * (sp->im[n] - sp->im[nk]);
+    or_ = 0.5f * (sp->im[n] + sp->im[nk]);
+    oi = -0.5f * (sp->re[n] - sp->re[nk]);
+
+    if (k < half)
+    {
+      xr = er + ((or_ * sp->tw_cos[k]) - (oi * sp->tw_sin[k]));
+      xi = ei + ((or_ * sp->tw_sin[k]) + (oi * sp->tw_cos[k]));
+    }
+
+    else
+    {
+      /* e^(-i pi) = -1 */
+      xr = er - or_;
+      xi = ei - oi;
+    }
+
+    sp->psd[a][k] += ((xr * xr) + (xi * xi)) * scale *
+                     (((k == 0U) || (k == half)) ? 1.0f : 2.0f);
+  }
+}
+
+/**
+  * @brief  Spectrum analyzer update with a block of samples. A new
+  *         segment is analyzed every I3G4250D_SPECTRUM_LEN / 2 samples.
+  *
+  * @param  sp    Spectrum analyzer instance.(ptr)
+  * @param  val   Raw samples, X Y Z interleaved.(ptr)
+  * @param  num   Number of samples
+  *
+  */
+void i3g4250d_spectrum_update(i3g4250d_spectrum_t *sp, const int16_t *val,
+                              uint16_t num)
+{
+  const uint16_t hop = I3G4250D_SPECTRUM_LEN / 2U;
+  uint16_t n;
+  uint8_t a;
+
+  for (n = 0U; n < num; n++)
+  {
+    for (a = 0U; a < 3U; a++)
+    {
+      sp->buf[a][sp->fill] = val[(3U * n) + a];
+    }
+
+    sp->fill++;
+
+    if (sp->fill == I3G4250D_SPECTRUM_LEN)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        i3g4250d_spectrum_segment(sp, a);
+        (void)memmove(&sp->buf[a][0], &sp->buf[a][hop],
+                      (I3G4250D_SPECTRUM_LEN - hop) * sizeof(int16_t));
+      }
+
+      sp->segments++;
+      sp->fill = I3G4250D_SPECTRUM_LEN - hop;
+    }
+  }
+}
+
+/**
+  * @brief  Averaged power spectral density of an axis.[get]
+  *         Bin k is centred on k * ODR / I3G4250D_SPECTRUM_LEN.
+  *
+  * @param  sp    Spectrum analyzer instance.(ptr)
+  * @param  axis  Axis (0: X, 1: Y, 2: Z)
+  * @param  val   I3G4250D_SPECTRUM_BINS values [LSB^2/Hz].(ptr)
+  * @retval       0: done; -1: no segment analyzed yet
+  *
+  */
+int32_t i3g4250d_spectrum_psd_get(const i3g4250d_spectrum_t *sp, uint8_t axis,
+                                  float_t *val)
+{
+  uint16_t k;
+
+  if ((sp->segments == 0U) || (axis > 2U)) { return -1; }
+
+  for (k = 0U; k < I3G4250D_SPECTRUM_BINS; k++)
+  {
+    val[k] = sp->psd[axis][k] / (float_t)sp->segments;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Signal power of an axis in a frequency band.[get]
+  *
+  * @param  sp    Spectrum analyzer instance.(ptr)
+  * @param  axis  Axis (0: X, 1: Y, 2: Z)
+  * @param  f_lo  Lower band edge [Hz]
+  * @param  f_hi  Upper band edge [Hz]
+  * @param  val   Band power [LSB^2].(ptr)
+  * @retval       0: done; -1: no segment analyzed yet
+  *
+  */
+int32_t i3g4250d_spectrum_band_get(const i3g4250d_spectrum_t *sp,
+                                   uint8_t axis, float_t f_lo, float_t f_hi,
+                                   float_t *val)
+{
+  float_t df;
+  float_t f;
+  uint16_t k;
+
+  if ((sp->segments == 0U) || (axis > 2U)) { return -1; }
+
+  df = sp->odr / (float_t)I3G4250D_SPECTRUM_LEN;
+  *val = 0.0f;
+
+  for (k = 0U; k < I3G4250D_SPECTRUM_BINS; k++)
+  {
+    f = (float_t)k * df;
+    if ((f >= f_lo) && (f <= f_hi))
+    {
+      *val += sp->psd[axis][k];
+    }
+  }
+
+  *val = (*val * df) / (float_t)sp->segments;
+
+  return 0;
+}
+
+/**
+  * @brief  Strongest spectral component of an axis, DC excluded. The
+  *         frequency is refined by parabolic interpolation.[get]
+  *
+  * @param  sp    Spectrum analyzer instance.(ptr)
+  * @param  axis  Axis (0: X, 1: Y, 2: Z)
+  * @param  freq  Peak frequency [Hz].(ptr)
+  * @param  psd   Peak power spectral density [LSB^2/Hz].(ptr)
+  * @retval       0: done; -1: no segment analyzed yet
+  *
+  */
+int32_t i3g4250d_spectrum_peak_get(const i3g4250d_spectrum_t *sp,
+                                   uint8_t axis, float_t *freq, float_t *psd)
+{
+  const float_t *p;
+  float_t den;
+  float_t off = 0.0f;
+  uint16_t best = 1U;
+  uint16_t k;
+
+  if ((sp->segments == 0U) || (axis > 2U)) { return -1; }
+
+  p = sp->psd[axis];
+
+  for (k = 2U; k < I3G4250D_SPECTRUM_BINS; k++)
+  {
+    if (p[k] > p[best])
+    {
+      best = k;
+    }
+  }
+
+  if (best < (I3G4250D_SPECTRUM_BINS - 1U))
+  {
+    den = p[best - 1U] - (2.0f * p[best]) + p[best + 1U];
+    if (den != 0.0f)
+    {
+      off = 0.5f * (p[best - 1U] - p[best + 1U]) / den;
+    }
+  }
+
+  *freq = ((float_t)best + off) * sp->odr / (float_t)I3G4250D_SPECTRUM_LEN;
+  *psd = p[best] / (float_t)sp->segments;
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
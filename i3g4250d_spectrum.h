@@ -0,0 +1,80 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_spectrum.h
+  * @author  Sensors Software Solution Team
+  * @brief   Optional spectral analysis of the i3g4250d driver: averaged
+  *          periodogram (Welch) of each axis.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_SPECTRUM_H
+#define I3G4250D_SPECTRUM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "i3g4250d_reg.h"
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+#ifndef I3G4250D_SPECTRUM_LEN
+#define I3G4250D_SPECTRUM_LEN            128U
+#endif /* I3G4250D_SPECTRUM_LEN */
+#if ((I3G4250D_SPECTRUM_LEN & (I3G4250D_SPECTRUM_LEN - 1U)) != 0U) || \
+    (I3G4250D_SPECTRUM_LEN < 8U)
+#error "I3G4250D_SPECTRUM_LEN must be a power of 2, at least 8"
+#endif /* I3G4250D_SPECTRUM_LEN */
+#define I3G4250D_SPECTRUM_BINS           ((I3G4250D_SPECTRUM_LEN / 2U) + 1U)
+typedef struct
+{
+  float_t window[I3G4250D_SPECTRUM_LEN];
+  float_t tw_cos[I3G4250D_SPECTRUM_LEN / 2U];
+  float_t tw_sin[I3G4250D_SPECTRUM_LEN / 2U];
+  float_t re[I3G4250D_SPECTRUM_LEN / 2U];
+  float_t im[I3G4250D_SPECTRUM_LEN / 2U];
+  float_t psd[3][I3G4250D_SPECTRUM_BINS];
+  int16_t buf[3][I3G4250D_SPECTRUM_LEN];
+  float_t odr;
+  float_t win_pow;
+  uint32_t segments;
+  uint16_t fill;
+} i3g4250d_spectrum_t;
+int32_t i3g4250d_spectrum_init(const stmdev_ctx_t *ctx,
+                               i3g4250d_spectrum_t *sp);
+void i3g4250d_spectrum_reset(i3g4250d_spectrum_t *sp);
+void i3g4250d_spectrum_update(i3g4250d_spectrum_t *sp, const int16_t *val,
+                              uint16_t num);
+int32_t i3g4250d_spectrum_psd_get(const i3g4250d_spectrum_t *sp,
+                                  uint8_t axis, float_t *val);
+int32_t i3g4250d_spectrum_band_get(const i3g4250d_spectrum_t *sp,
+                                   uint8_t axis, float_t f_lo, float_t f_hi,
+                                   float_t *val);
+int32_t i3g4250d_spectrum_peak_get(const i3g4250d_spectrum_t *sp,
+                                   uint8_t axis, float_t *freq, float_t *psd);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_SPECTRUM_H */
@@ -0,0 +1,307 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_stats.c
+  * @author  Sensors Software Solution Team
+  * @brief   Optional running statistics of the i3g4250d driver on blocks
+  *          of raw samples: accumulated and sliding window.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_stats.h"
+#include <string.h>
+
+/**
+  * @addtogroup  I3G4250D
+  * @{
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_statistics
+  * @brief      This section groups the per-axis running statistics
+  *             computed on drained blocks of raw samples.
+  *             Accumulated (tumbling) statistics: each block is reduced
+  *             with integer sums, then merged into a Welford state with
+  *             the pairwise update of Chan et al.
+  *             Sliding statistics: exact integer sums for mean, variance
+  *             and rms, monotonic queues for min / max; every sample
+  *             update is O(1) amortized.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Clear accumulated statistics (start of a tumbling window).
+  *
+  * @param  st    Statistics instance.(ptr)
+  *
+  */
+void i3g4250d_stats_reset(i3g4250d_stats_t *st)
+{
+  (void)memset(st, 0, sizeof(i3g4250d_stats_t));
+}
+
+/**
+  * @brief  Accumulate a block of samples.
+  *
+  * @param  st    Statistics instance.(ptr)
+  * @param  val   Raw samples, X Y Z interleaved.(ptr)
+  * @param  num   Number of samples
+  *
+  */
+void i3g4250d_stats_update(i3g4250d_stats_t *st, const int16_t *val,
+                           uint16_t num)
+{
+  int64_t sum2[3] = { 0, 0, 0 };
+  int32_t sum[3] = { 0, 0, 0 };
+  int16_t min[3];
+  int16_t max[3];
+  float_t mean_b;
+  float_t m2_b;
+  float_t delta;
+  float_t tot;
+  int16_t x;
+  uint16_t n;
+  uint8_t a;
+
+  if (num == 0U) { return; }
+
+  for (a = 0U; a < 3U; a++)
+  {
+    min[a] = val[a];
+    max[a] = val[a];
+  }
+
+  for (n = 0U; n < num; n++)
+  {
+    for (a = 0U; a < 3U; a++)
+    {
+      x = val[(3U * n) + a];
+      sum[a] += x;
+      sum2[a] += (int32_t)x * x;
+      min[a] = (x < min[a]) ? x : min[a];
+      max[a] = (x > max[a]) ? x : max[a];
+    }
+  }
+
+  tot = (float_t)st->count + (float_t)num;
+
+  for (a = 0U; a < 3U; a++)
+  {
+    mean_b = (float_t)sum[a] / (float_t)num;
+    m2_b = (float_t)(((int64_t)num * sum2[a]) - ((int64_t)sum[a] * sum[a])) /
+           (float_t)num;
+    delta = mean_b - st->mean[a];
+
+    st->mean[a] += delta * ((float_t)num / tot);
+    st->m2[a] += m2_b + (delta * delta *
+                         (((float_t)st->count * (float_t)num) / tot));
+
+    if ((st->count == 0U) || (min[a] < st->min[a]))
+    {
+      st->min[a] = min[a];
+    }
+    if ((st->count == 0U) || (max[a] > st->max[a]))
+    {
+      st->max[a] = max[a];
+    }
+  }
+
+  st->count += num;
+}
+
+/**
+  * @brief  Accumulated statistics.[get]
+  *
+  * @param  st    Statistics instance.(ptr)
+  * @param  val   Mean, variance (population), rms, min and max per axis
+  *               [LSB].(ptr)
+  *
+  */
+void i3g4250d_stats_get(const i3g4250d_stats_t *st, i3g4250d_stats_out_t *val)
+{
+  uint8_t a;
+
+  (void)memset(val, 0, sizeof(i3g4250d_stats_out_t));
+  val->count = st->count;
+  if (st->count == 0U) { return; }
+
+  for (a = 0U; a < 3U; a++)
+  {
+    val->mean[a] = st->mean[a];
+    val->var[a] = st->m2[a] / (float_t)st->count;
+    val->rms[a] = sqrtf(val->var[a] + (st->mean[a] * st->mean[a]));
+    val->min[a] = st->min[a];
+    val->max[a] = st->max[a];
+  }
+}
+
+/**
+  * @brief  Sliding statistics initialization.
+  *
+  * @param  st    Sliding statistics instance.(ptr)
+  * @param  slot  Window storage, len elements.(ptr)
+  * @param  len   Window length [samples]
+  *
+  */
+void i3g4250d_sliding_stats_init(i3g4250d_sliding_stats_t *st,
+                                 i3g4250d_stats_slot_t *slot, uint16_t len)
+{
+  (void)memset(st, 0, sizeof(i3g4250d_sliding_stats_t));
+  st->slot = slot;
+  st->len = len;
+}
+
+/**
+  * @brief  Push the slot index of the new sample at the back of a
+  *         monotonic queue, after dropping the entries it dominates.
+  *
+  * @param  st    Sliding statistics instance.(ptr)
+  * @param  q     Queue (0: min, 1: max)
+  * @param  a     Axis
+  * @param  x     New sample
+  *
+  */
+static void i3g4250d_sliding_queue_push(i3g4250d_sliding_stats_t *st,
+                                        uint8_t q, uint8_t a, int16_t x)
+{
+  uint16_t back;
+  int16_t y;
+
+  while (st->q_size[q][a] > 0U)
+  {
+    back = st->slot[(st->q_head[q][a] + st->q_size[q][a] - 1U) % st->len]
+           .queue[q][a];
+    y = st->slot[back].val[a];
+
+    if (((q == 0U) && (y < x)) || ((q != 0U) && (y > x)))
+    {
+      break;
+    }
+
+    st->q_size[q][a]--;
+  }
+
+  st->slot[(st->q_head[q][a] + st->q_size[q][a]) % st->len].queue[q][a] =
+    st->pos;
+  st->q_size[q][a]++;
+}
+
+/**
+  * @brief  Sliding statistics update with a block of samples.
+  *
+  * @param  st    Sliding statistics instance.(ptr)
+  * @param  val   Raw samples, X Y Z interleaved.(ptr)
+  * @param  num   Number of samples
+  *
+  */
+void i3g4250d_sliding_stats_update(i3g4250d_sliding_stats_t *st,
+                                   const int16_t *val, uint16_t num)
+{
+  i3g4250d_stats_slot_t *s;
+  int16_t x;
+  uint16_t n;
+  uint8_t q;
+  uint8_t a;
+
+  if (st->len == 0U) { return; }
+
+  for (n = 0U; n < num; n++)
+  {
+    s = &st->slot[st->pos];
+
+    for (a = 0U; a < 3U; a++)
+    {
+      if (st->count == st->len)
+      {
+        /* evict the oldest sample */
+        x = s->val[a];
+        st->sum[a] -= x;
+        st->sum2[a] -= (int32_t)x * x;
+
+        for (q = 0U; q < 2U; q++)
+        {
+          /* the oldest sample lives in the slot being overwritten */
+          if (st->slot[st->q_head[q][a]].queue[q][a] == st->pos)
+          {
+            st->q_head[q][a] = (uint16_t)((st->q_head[q][a] + 1U) % st->len);
+            st->q_size[q][a]--;
+          }
+        }
+      }
+
+      x = val[(3U * n) + a];
+      s->val[a] = x;
+      st->sum[a] += x;
+      st->sum2[a] += (int32_t)x * x;
+    }
+
+    for (a = 0U; a < 3U; a++)
+    {
+      i3g4250d_sliding_queue_push(st, 0U, a, s->val[a]);
+      i3g4250d_sliding_queue_push(st, 1U, a, s->val[a]);
+    }
+
+    if (st->count < st->len)
+    {
+      st->count++;
+    }
+
+    st->pos = (uint16_t)((st->pos + 1U) % st->len);
+  }
+}
+
+/**
+  * @brief  Statistics over the current sliding window.[get]
+  *
+  * @param  st    Sliding statistics instance.(ptr)
+  * @param  val   Mean, variance (population), rms, min and max per axis
+  *               [LSB].(ptr)
+  *
+  */
+void i3g4250d_sliding_stats_get(const i3g4250d_sliding_stats_t *st,
+                                i3g4250d_stats_out_t *val)
+{
+  float_t cnt;
+  uint16_t idx;
+  uint8_t a;
+
+  (void)memset(val, 0, sizeof(i3g4250d_stats_out_t));
+  val->count = st->count;
+  if (st->count == 0U) { return; }
+
+  cnt = (float_t)st->count;
+
+  for (a = 0U; a < 3U; a++)
+  {
+    val->mean[a] = (float_t)st->sum[a] / cnt;
+    val->var[a] = (float_t)(((int64_t)st->count * st->sum2[a]) -
+                            ((int64_t)st->sum[a] * st->sum[a])) / (cnt * cnt);
+    val->rms[a] = sqrtf((float_t)st->sum2[a] / cnt);
+
+    idx = st->slot[st->q_head[0][a]].queue[0][a];
+    val->min[a] = st->slot[idx].val[a];
+    idx = st->slot[st->q_head[1][a]].queue[1][a];
+    val->max[a] = st->slot[idx].val[a];
+  }
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
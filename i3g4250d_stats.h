@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_stats.h
+  * @author  Sensors Software Solution Team
+  * @brief   Optional running statistics of the i3g4250d driver on blocks
+  *          of raw samples: accumulated and sliding window.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_STATS_H
+#define I3G4250D_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "i3g4250d_reg.h"
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+typedef struct
+{
+  float_t mean[3];
+  float_t var[3];
+  float_t rms[3];
+  int16_t min[3];
+  int16_t max[3];
+  uint32_t count;
+} i3g4250d_stats_out_t;
+
+typedef struct
+{
+  float_t mean[3];
+  float_t m2[3];
+  int16_t min[3];
+  int16_t max[3];
+  uint32_t count;
+} i3g4250d_stats_t;
+void i3g4250d_stats_reset(i3g4250d_stats_t *st);
+void i3g4250d_stats_update(i3g4250d_stats_t *st, const int16_t *val,
+                           uint16_t num);
+void i3g4250d_stats_get(const i3g4250d_stats_t *st,
+                        i3g4250d_stats_out_t *val);
+
+typedef struct
+{
+  uint16_t queue[2][3];       /* min / max monotonic queues storage */
+  int16_t val[3];
+} i3g4250d_stats_slot_t;
+
+typedef struct
+{
+  i3g4250d_stats_slot_t *slot;
+  int64_t sum2[3];
+  int32_t sum[3];
+  uint16_t pos;               /* slot of the next sample */
+  uint16_t q_head[2][3];
+  uint16_t q_size[2][3];
+  uint16_t len;
+  uint16_t count;
+} i3g4250d_sliding_stats_t;
+void i3g4250d_sliding_stats_init(i3g4250d_sliding_stats_t *st,
+                                 i3g4250d_stats_slot_t *slot, uint16_t len);
+void i3g4250d_sliding_stats_update(i3g4250d_sliding_stats_t *st,
+                                   const int16_t *val, uint16_t num);
+void i3g4250d_sliding_stats_get(const i3g4250d_sliding_stats_t *st,
+                                i3g4250d_stats_out_t *val);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_STATS_H */
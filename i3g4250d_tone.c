@@ -0,0 +1,204 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_tone.c
+  * @author  Sensors Software Solution Team
+  * @brief   Optional tone detector of the i3g4250d driver: Goertzel filter
+  *          bank on blocks of raw samples.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "i3g4250d_tone.h"
+#include <string.h>
+
+#define I3G4250D_PI                      3.14159265f
+
+/**
+  * @addtogroup  I3G4250D
+  * @{
+  *
+  */
+
+/**
+  * @defgroup   I3G4250D_tone_detector
+  * @brief      This section groups the Goertzel tone detectors. Each tone
+  *             is evaluated on the three axes over blocks of "len"
+  *             samples, at a cost of one multiply-accumulate per tone,
+  *             axis and sample. At the end of each block the tone
+  *             amplitude is compared to its threshold.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Tone detector bank initialization. Tone frequencies are
+  *         converted to Goertzel coefficients using the data rate
+  *         currently set in the device.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  bank   Tone detector bank.(ptr)
+  * @param  tone   Tones to monitor.(ptr)
+  * @param  num    Number of tones (up to I3G4250D_TONE_MAX)
+  * @param  len    Samples per evaluation block
+  * @retval        Interface status (MANDATORY: return 0 -> no Error)
+  *                -1 also on invalid parameters, when a tone rounds to
+  *                the DC bin or to a bin at or above len / 2, or when
+  *                the device doesn't generate data
+  *
+  */
+int32_t i3g4250d_tone_init(const stmdev_ctx_t *ctx, i3g4250d_tone_bank_t *bank,
+                           const i3g4250d_tone_t *tone, uint8_t num,
+                           uint16_t len)
+{
+  float_t odr;
+  float_t bin;
+  uint8_t t;
+  int32_t ret;
+
+  if ((num == 0U) || (num > I3G4250D_TONE_MAX) || (len == 0U)) { return -1; }
+
+  ret = i3g4250d_data_rate_hz_get(ctx, &odr);
+  if (ret != 0) { return ret; }
+
+  if (odr == 0.0f) { return -1; }
+
+  (void)memset(bank, 0, sizeof(i3g4250d_tone_bank_t));
+  bank->num = num;
+  bank->len = len;
+
+  for (t = 0U; t < num; t++)
+  {
+    if ((tone[t].freq_hz <= 0.0f) || (tone[t].freq_hz >= (odr * 0.5f)))
+    {
+      return -1;
+    }
+
+    /* nearest bin of a len-point DFT, DC and Nyquist excluded */
+    bin = floorf(((tone[t].freq_hz * (float_t)len) / odr) + 0.5f);
+    if ((bin < 1.0f) || ((2.0f * bin) >= (float_t)len)) { return -1; }
+    bank->coef[t] = 2.0f * cosf((2.0f * I3G4250D_PI * bin) / (float_t)len);
+    bank->freq_hz[t] = (bin * odr) / (float_t)len;
+    bank->thr[t] = tone[t].threshold;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Tone detector bank update with a block of samples.
+  *
+  * @param  bank   Tone detector bank.(ptr)
+  * @param  val    Raw samples, X Y Z interleaved.(ptr)
+  * @param  num    Number of samples
+  * @retval        Bit mask of the tones above threshold on at least one
+  *                axis in any of the evaluation blocks completed in this
+  *                call (bit t for tone t), 0 if none
+  *
+  */
+uint32_t i3g4250d_tone_update(i3g4250d_tone_bank_t *bank, const int16_t *val,
+                              uint16_t num)
+{
+  uint32_t event = 0U;
+  uint32_t block;
+  float_t s0;
+  float_t power;
+  float_t amp;
+  float_t x[3];
+  uint16_t n;
+  uint8_t t;
+  uint8_t a;
+
+  for (n = 0U; n < num; n++)
+  {
+    for (a = 0U; a < 3U; a++)
+    {
+      x[a] = (float_t)val[(3U * n) + a];
+    }
+
+    for (t = 0U; t < bank->num; t++)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        s0 = x[a] + (bank->coef[t] * bank->s1[t][a]) - bank->s2[t][a];
+        bank->s2[t][a] = bank->s1[t][a];
+        bank->s1[t][a] = s0;
+      }
+    }
+
+    bank->count++;
+
+    if (bank->count == bank->len)
+    {
+      block = 0U;
+
+      for (t = 0U; t < bank->num; t++)
+      {
+        for (a = 0U; a < 3U; a++)
+        {
+          power = (bank->s1[t][a] * bank->s1[t][a]) +
+                  (bank->s2[t][a] * bank->s2[t][a]) -
+                  (bank->coef[t] * bank->s1[t][a] * bank->s2[t][a]);
+          /* peak amplitude of a sinusoid centred on the bin */
+          amp = (2.0f * sqrtf((power > 0.0f) ? power : 0.0f)) /
+                (float_t)bank->len;
+          bank->amp[t][a] = amp;
+
+          if (amp > bank->thr[t])
+          {
+            block |= (1UL << t);
+          }
+
+          bank->s1[t][a] = 0.0f;
+          bank->s2[t][a] = 0.0f;
+        }
+      }
+
+      /* an alarm of an earlier block in this call is kept */
+      bank->event = block;
+      event |= block;
+      bank->count = 0U;
+    }
+  }
+
+  return event;
+}
+
+/**
+  * @brief  Tone amplitudes of the last completed block.[get]
+  *
+  * @param  bank   Tone detector bank.(ptr)
+  * @param  tone   Tone index
+  * @param  val    Amplitude on X, Y, Z [LSB].(ptr)
+  * @retval        0: done; -1: invalid tone index
+  *
+  */
+int32_t i3g4250d_tone_amplitude_get(const i3g4250d_tone_bank_t *bank,
+                                    uint8_t tone, float_t *val)
+{
+  if (tone >= bank->num) { return -1; }
+
+  val[0] = bank->amp[tone][0];
+  val[1] = bank->amp[tone][1];
+  val[2] = bank->amp[tone][2];
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
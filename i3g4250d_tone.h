@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    i3g4250d_tone.h
+  * @author  Sensors Software Solution Team
+  * @brief   Optional tone detector of the i3g4250d driver: Goertzel filter
+  *          bank on blocks of raw samples.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef I3G4250D_TONE_H
+#define I3G4250D_TONE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "i3g4250d_reg.h"
+
+/** @addtogroup I3G4250D
+  * @{
+  *
+  */
+
+typedef struct
+{
+  float_t freq_hz;            /* tone frequency */
+  float_t threshold;          /* event threshold, peak amplitude [LSB] */
+} i3g4250d_tone_t;
+
+#ifndef I3G4250D_TONE_MAX
+#define I3G4250D_TONE_MAX                8U
+#endif /* I3G4250D_TONE_MAX */
+#if (I3G4250D_TONE_MAX > 32U)
+#error "I3G4250D_TONE_MAX must not exceed 32 (tone event bit mask)"
+#endif /* I3G4250D_TONE_MAX */
+typedef struct
+{
+  float_t coef[I3G4250D_TONE_MAX];
+  float_t freq_hz[I3G4250D_TONE_MAX]; /* frequency of the bin used */
+  float_t thr[I3G4250D_TONE_MAX];
+  float_t s1[I3G4250D_TONE_MAX][3];
+  float_t s2[I3G4250D_TONE_MAX][3];
+  float_t amp[I3G4250D_TONE_MAX][3];
+  uint32_t event;             /* tones above threshold, last block */
+  uint16_t len;
+  uint16_t count;
+  uint8_t num;
+} i3g4250d_tone_bank_t;
+int32_t i3g4250d_tone_init(const stmdev_ctx_t *ctx,
+                           i3g4250d_tone_bank_t *bank,
+                           const i3g4250d_tone_t *tone, uint8_t num,
+                           uint16_t len);
+uint32_t i3g4250d_tone_update(i3g4250d_tone_bank_t *bank, const int16_t *val,
+                              uint16_t num);
+int32_t i3g4250d_tone_amplitude_get(const i3g4250d_tone_bank_t *bank,
+                                    uint8_t tone, float_t *val);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I3G4250D_TONE_H */
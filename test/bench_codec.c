@@ -0,0 +1,73 @@
+/*
+ ******************************************************************************
+ * @file    bench_codec.c
+ * @brief   Encode and decode throughput of the block codec, in MB/s of raw
+ *          samples (6 bytes per X Y Z sample).
+ ******************************************************************************
+ */
+
+#include "i3g4250d_codec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TOTAL  (64L * 1024L * 1024L)   /* raw bytes per measure */
+
+static double now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void run(uint16_t num, int noise)
+{
+  static int16_t val[3U * 4096U];
+  static int16_t dec[3U * 4096U];
+  static uint8_t enc[I3G4250D_CODEC_MAX_SIZE(4096U)];
+  long blocks = TOTAL / (6L * num);
+  uint32_t len = 0U;
+  uint16_t got = 0U;
+  double t0;
+  double te;
+  double td;
+  long b;
+  uint32_t i;
+
+  srand(1U);
+  for (i = 0U; i < (3U * num); i++)
+  {
+    val[i] = (int16_t)(((i % 3U) * 100U) + (uint32_t)(rand() % noise));
+  }
+
+  t0 = now_ns();
+  for (b = 0; b < blocks; b++)
+  {
+    len = i3g4250d_codec_encode(val, num, enc);
+  }
+  te = now_ns() - t0;
+
+  t0 = now_ns();
+  for (b = 0; b < blocks; b++)
+  {
+    if (i3g4250d_codec_decode(enc, len, dec, num, &got) != 0) { abort(); }
+  }
+  td = now_ns() - t0;
+
+  (void)printf("%5u samples, noise %4d LSB, ratio %.2f: encode %7.1f MB/s,"
+               " decode %7.1f MB/s\n", num, noise,
+               (double)len / (6.0 * num),
+               ((double)blocks * 6.0 * num * 1e3) / te,
+               ((double)blocks * 6.0 * num * 1e3) / td);
+}
+
+int main(void)
+{
+  run(32U, 16);
+  run(32U, 1024);
+  run(4096U, 16);
+  run(4096U, 1024);
+
+  return 0;
+}
@@ -0,0 +1,205 @@
+/*
+ ******************************************************************************
+ * @file    bench_event.c
+ * @brief   Wake-to-data latency and CPU time of the consumer, for a
+ *          watermark every 5 ms on an emulated FIFO: delivered through
+ *          an eventfd and epoll, and polled from a 1 ms sleep loop.
+ *          Then one second without watermark.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_linux.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#define EVENTS     200U
+#define PERIOD_NS  5000000L
+#define POLL_NS    1000000L
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t pending;
+static double t_signal;
+static double lat_sum;
+static double lat_max;
+static uint32_t drained;
+static int line_fd = -1;
+
+static double now_ns(clockid_t clk)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(clk, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void sleep_ns(long ns)
+{
+  struct timespec ts = { 0, ns };
+
+  (void)nanosleep(&ts, NULL);
+}
+
+static int32_t bus_read(void *handle, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
+{
+  (void)handle;
+  (void)pthread_mutex_lock(&lock);
+  if ((reg & 0x3FU) == I3G4250D_FIFO_SRC_REG)
+  {
+    buf[0] = (pending == 0U) ? 0x20U : (uint8_t)pending;
+  }
+  else
+  {
+    (void)memset(buf, 0, len);
+    pending -= len / 6U;
+  }
+  (void)pthread_mutex_unlock(&lock);
+
+  return 0;
+}
+
+static int32_t bus_write(void *handle, uint8_t reg, const uint8_t *buf,
+                         uint16_t len)
+{
+  (void)handle;
+  (void)reg;
+  (void)buf;
+  (void)len;
+  return 0;
+}
+
+static void consume(void *user, const int16_t *val, uint8_t num)
+{
+  double lat;
+
+  (void)user;
+  (void)val;
+  (void)pthread_mutex_lock(&lock);
+  lat = now_ns(CLOCK_MONOTONIC) - t_signal;
+  (void)pthread_mutex_unlock(&lock);
+
+  lat_sum += lat;
+  lat_max = (lat > lat_max) ? lat : lat_max;
+  drained += num;
+}
+
+/* watermark of 16 samples every PERIOD_NS */
+static void *producer(void *arg)
+{
+  uint64_t one = 1U;
+  uint32_t e;
+
+  (void)arg;
+  for (e = 0U; e < EVENTS; e++)
+  {
+    sleep_ns(PERIOD_NS);
+    (void)pthread_mutex_lock(&lock);
+    pending += 16U;
+    t_signal = now_ns(CLOCK_MONOTONIC);
+    (void)pthread_mutex_unlock(&lock);
+    if (line_fd >= 0)
+    {
+      (void)write(line_fd, &one, sizeof(one));
+    }
+  }
+
+  return NULL;
+}
+
+static void report(const char *name, double cpu, uint32_t wakeups,
+                   double idle_cpu, uint32_t idle_wakeups)
+{
+  (void)printf("%s: latency mean %7.1f us, max %7.1f us, CPU %6.2f ms,"
+               " %4u wakeups; idle 1 s: CPU %5.2f ms, %4u wakeups\n",
+               name, lat_sum / (EVENTS * 1e3), lat_max / 1e3, cpu / 1e6,
+               wakeups, idle_cpu / 1e6, idle_wakeups);
+  lat_sum = 0.0;
+  lat_max = 0.0;
+  drained = 0U;
+}
+
+int main(void)
+{
+  static i3g4250d_linux_dev_t dev;
+  stmdev_ctx_t ctx;
+  pthread_t thr;
+  uint32_t wakeups;
+  uint32_t idle_wakeups;
+  int16_t val[3U * I3G4250D_FIFO_DEPTH];
+  double idle_cpu;
+  double cpu;
+  double t0;
+  uint8_t num;
+  int epfd;
+
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = bus_read;
+  ctx.write_reg = bus_write;
+
+  /* epoll on the line */
+  epfd = epoll_create1(0);
+  line_fd = eventfd(0U, EFD_NONBLOCK);
+  dev.ctx = &ctx;
+  dev.consume = consume;
+  dev.fd = line_fd;
+  (void)i3g4250d_linux_event_add(epfd, &dev);
+
+  wakeups = 0U;
+  (void)pthread_create(&thr, NULL, producer, NULL);
+  cpu = now_ns(CLOCK_THREAD_CPUTIME_ID);
+  while (drained < (EVENTS * 16U))
+  {
+    (void)i3g4250d_linux_event_dispatch(epfd, -1);
+    wakeups++;
+  }
+  cpu = now_ns(CLOCK_THREAD_CPUTIME_ID) - cpu;
+  (void)pthread_join(thr, NULL);
+
+  idle_wakeups = 0U;
+  idle_cpu = now_ns(CLOCK_THREAD_CPUTIME_ID);
+  while (i3g4250d_linux_event_dispatch(epfd, 1000) != 0)
+  {
+    idle_wakeups++;
+  }
+  report("epoll + eventfd    ", cpu, wakeups,
+         now_ns(CLOCK_THREAD_CPUTIME_ID) - idle_cpu, idle_wakeups);
+
+  /* 1 ms sleep loop */
+  line_fd = -1;
+  wakeups = 0U;
+  (void)pthread_create(&thr, NULL, producer, NULL);
+  cpu = now_ns(CLOCK_THREAD_CPUTIME_ID);
+  while (drained < (EVENTS * 16U))
+  {
+    sleep_ns(POLL_NS);
+    wakeups++;
+    if ((i3g4250d_fifo_drain(&ctx, val, 32U, &num) == 0) && (num > 0U))
+    {
+      consume(NULL, val, num);
+    }
+  }
+  cpu = now_ns(CLOCK_THREAD_CPUTIME_ID) - cpu;
+  (void)pthread_join(thr, NULL);
+
+  idle_wakeups = 0U;
+  t0 = now_ns(CLOCK_MONOTONIC);
+  idle_cpu = now_ns(CLOCK_THREAD_CPUTIME_ID);
+  while ((now_ns(CLOCK_MONOTONIC) - t0) < 1e9)
+  {
+    sleep_ns(POLL_NS);
+    idle_wakeups++;
+    (void)i3g4250d_fifo_drain(&ctx, val, 32U, &num);
+  }
+  report("1 ms sleep polling ", cpu, wakeups,
+         now_ns(CLOCK_THREAD_CPUTIME_ID) - idle_cpu, idle_wakeups);
+
+  (void)close(dev.fd);
+  (void)close(epfd);
+
+  return 0;
+}
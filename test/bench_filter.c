@@ -0,0 +1,113 @@
+/*
+ ******************************************************************************
+ * @file    bench_filter.c
+ * @brief   Time per X Y Z sample of the post-filters, on 512 sample blocks.
+ *          Built once as usual and once with the loop vectorizer disabled
+ *          (-fno-tree-vectorize), to measure the gain of the four-lane
+ *          state layout.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_filter.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NUM     512U
+#define BLOCKS  20000L
+
+static int16_t in[3U * NUM];
+static float_t out[3U * NUM];
+
+static double now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void biquad(uint8_t stages)
+{
+  i3g4250d_biquad_coef_t coef[I3G4250D_BIQUAD_MAX_STAGES];
+  i3g4250d_biquad_t bq;
+  double t0;
+  long b;
+  uint8_t s;
+
+  for (s = 0U; s < stages; s++)
+  {
+    (void)i3g4250d_biquad_coef_get(I3G4250D_BIQUAD_LOW_PASS, 20.0f, 400.0f,
+                                   0.7071f, &coef[s]);
+  }
+  (void)i3g4250d_biquad_init(&bq, coef, stages);
+
+  t0 = now_ns();
+  for (b = 0; b < BLOCKS; b++)
+  {
+    i3g4250d_biquad_process(&bq, in, out, NUM);
+  }
+  (void)printf("biquad, %u stages:    %6.2f ns per sample (%g)\n", stages,
+               (now_ns() - t0) / ((double)BLOCKS * NUM), (double)out[0]);
+}
+
+static void mavg(uint8_t len)
+{
+  i3g4250d_mavg_t ma;
+  double t0;
+  long b;
+
+  (void)i3g4250d_mavg_init(&ma, len);
+
+  t0 = now_ns();
+  for (b = 0; b < BLOCKS; b++)
+  {
+    i3g4250d_mavg_process(&ma, in, out, NUM);
+  }
+  (void)printf("moving average, %2u:   %6.2f ns per sample (%g)\n", len,
+               (now_ns() - t0) / ((double)BLOCKS * NUM), (double)out[0]);
+}
+
+static void cic(uint8_t order, uint16_t rate)
+{
+  i3g4250d_cic_t flt;
+  uint16_t got = 0U;
+  double t0;
+  long b;
+
+  (void)i3g4250d_cic_init(&flt, order, rate);
+
+  t0 = now_ns();
+  for (b = 0; b < BLOCKS; b++)
+  {
+    got = i3g4250d_cic_process(&flt, in, NUM, out);
+  }
+  (void)printf("CIC, order %u, R %2u:  %6.2f ns per sample (%u, %g)\n",
+               order, rate, (now_ns() - t0) / ((double)BLOCKS * NUM), got,
+               (double)out[0]);
+}
+
+int main(void)
+{
+  uint32_t i;
+
+  srand(1U);
+  for (i = 0U; i < (3U * NUM); i++)
+  {
+    in[i] = (int16_t)(((i % 3U) * 100U) + (uint32_t)(rand() % 2000));
+  }
+
+  (void)printf("loop vectorizer %s\n",
+#if defined(I3G4250D_BENCH_NOVEC)
+               "off"
+#else
+               "on"
+#endif
+              );
+  biquad(1U);
+  biquad(4U);
+  mavg(16U);
+  cic(3U, 8U);
+
+  return 0;
+}
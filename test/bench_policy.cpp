@@ -0,0 +1,154 @@
+/*
+ ******************************************************************************
+ * @file    bench_policy.cpp
+ * @brief   Time per API call on an in-memory bus: the C API through the
+ *          stmdev_ctx_t function pointers, the C++17 driver on the
+ *          stmdev_ctx_t policy, and the C++17 driver on a bus policy
+ *          inlined at compile time.
+ ******************************************************************************
+ */
+
+#include "i3g4250d.hpp"
+#include <stdio.h>
+#include <time.h>
+
+#define LOOPS  20000000L
+
+/* every iteration really accesses the register memory */
+#define CLOBBER()  __asm__ __volatile__("" : : : "memory")
+
+static uint8_t regs[0x40];
+
+static inline int32_t mem_read(uint8_t reg, uint8_t *buf, uint16_t len)
+{
+  (void)memcpy(buf, &regs[reg & 0x3FU], len);
+  return 0;
+}
+
+static inline int32_t mem_write(uint8_t reg, const uint8_t *buf,
+                                uint16_t len)
+{
+  (void)memcpy(&regs[reg & 0x3FU], buf, len);
+  return 0;
+}
+
+static int32_t ctx_read(void *handle, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
+{
+  (void)handle;
+  return mem_read(reg, buf, len);
+}
+
+static int32_t ctx_write(void *handle, uint8_t reg, const uint8_t *buf,
+                         uint16_t len)
+{
+  (void)handle;
+  return mem_write(reg, buf, len);
+}
+
+struct mem_bus
+{
+  static constexpr uint8_t auto_increment = I3G4250D_I2C_AUTO_INCREMENT;
+
+  int32_t read(uint8_t reg, uint8_t *data, uint16_t len)
+  {
+    return mem_read(reg, data, len);
+  }
+
+  int32_t write(uint8_t reg, const uint8_t *data, uint16_t len)
+  {
+    return mem_write(reg, data, len);
+  }
+};
+
+static double now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void report(const char *name, double t_set, double t_get,
+                   const int16_t *val)
+{
+  (void)printf("%-24s full_scale_set %5.2f ns, angular_rate_raw_get"
+               " %5.2f ns (%d)\n", name, t_set / LOOPS, t_get / LOOPS,
+               val[0] + val[1] + val[2]);
+}
+
+template <class Bus>
+static void run(const char *name, i3g4250d::device<Bus> &dev)
+{
+  int16_t val[3] = { 0, 0, 0 };
+  int16_t acc[3] = { 0, 0, 0 };
+  double t0;
+  double t_set;
+  long i;
+
+  t0 = now_ns();
+  for (i = 0; i < LOOPS; i++)
+  {
+    (void)dev.full_scale_set((i3g4250d_fs_t)(i & 1));
+    CLOBBER();
+  }
+  t_set = now_ns() - t0;
+
+  t0 = now_ns();
+  for (i = 0; i < LOOPS; i++)
+  {
+    (void)dev.angular_rate_raw_get(val);
+    acc[i % 3] = (int16_t)(acc[i % 3] + val[i % 3]);
+    CLOBBER();
+  }
+
+  report(name, t_set, now_ns() - t0, acc);
+}
+
+int main(void)
+{
+  stmdev_ctx_t ctx;
+  int16_t val[3] = { 0, 0, 0 };
+  int16_t acc[3] = { 0, 0, 0 };
+  double t0;
+  double t_set;
+  long i;
+
+  for (i = 0; i < 0x40; i++)
+  {
+    regs[i] = (uint8_t)(i * 13);
+  }
+
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = ctx_read;
+  ctx.write_reg = ctx_write;
+
+  t0 = now_ns();
+  for (i = 0; i < LOOPS; i++)
+  {
+    (void)i3g4250d_full_scale_set(&ctx, (i3g4250d_fs_t)(i & 1));
+    CLOBBER();
+  }
+  t_set = now_ns() - t0;
+
+  t0 = now_ns();
+  for (i = 0; i < LOOPS; i++)
+  {
+    (void)i3g4250d_angular_rate_raw_get(&ctx, val);
+    acc[i % 3] = (int16_t)(acc[i % 3] + val[i % 3]);
+    CLOBBER();
+  }
+  report("C API, stmdev_ctx_t", t_set, now_ns() - t0, acc);
+
+  {
+    i3g4250d::device<i3g4250d::ctx_bus> dev{i3g4250d::ctx_bus(&ctx)};
+    run("C++, ctx_bus policy", dev);
+  }
+
+  {
+    i3g4250d::device<mem_bus> dev(mem_bus{});
+    run("C++, inlined bus policy", dev);
+  }
+
+  return 0;
+}
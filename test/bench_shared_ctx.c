@@ -0,0 +1,145 @@
+/*
+ ******************************************************************************
+ * @file    bench_shared_ctx.c
+ * @brief   Cost of the cached register reads of a shared context, with and
+ *          without a concurrent writer, against reads taking the bus lock.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_reg.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define READS 2000000L
+
+static pthread_mutex_t bus_mtx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t reg_mtx = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t regs[0x40];
+static int stop;
+
+static void lock(void *handle, uint8_t id)
+{
+  (void)handle;
+  (void)pthread_mutex_lock((id == I3G4250D_LOCK_BUS) ? &bus_mtx : &reg_mtx);
+}
+
+static void unlock(void *handle, uint8_t id)
+{
+  (void)handle;
+  (void)pthread_mutex_unlock((id == I3G4250D_LOCK_BUS) ? &bus_mtx :
+                             &reg_mtx);
+}
+
+static int32_t bus_read(void *handle, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
+{
+  (void)handle;
+  (void)memcpy(buf, &regs[reg & 0x3FU], len);
+  return 0;
+}
+
+static int32_t bus_write(void *handle, uint8_t reg, const uint8_t *buf,
+                         uint16_t len)
+{
+  (void)handle;
+  (void)memcpy(&regs[reg & 0x3FU], buf, len);
+  return 0;
+}
+
+static i3g4250d_priv_t priv;
+static stmdev_ctx_t ctx = { bus_write, bus_read, NULL, NULL, &priv };
+
+static double now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void *writer(void *arg)
+{
+  long n = 0;
+
+  (void)arg;
+  while (__atomic_load_n(&stop, __ATOMIC_ACQUIRE) == 0)
+  {
+    (void)i3g4250d_data_rate_set(&ctx, ((n & 1) != 0) ? I3G4250D_ODR_800Hz :
+                                 I3G4250D_ODR_100Hz);
+    n++;
+  }
+
+  return NULL;
+}
+
+static double lock_free_reads(void)
+{
+  double t0 = now_ns();
+  uint8_t val;
+  long i;
+
+  for (i = 0; i < READS; i++)
+  {
+    (void)i3g4250d_ctrl_reg_cached_get(&ctx, I3G4250D_CTRL_REG1, &val);
+  }
+
+  return (now_ns() - t0) / (double)READS;
+}
+
+/* previous scheme: every cached read takes the bus lock */
+static double locked_reads(void)
+{
+  double t0 = now_ns();
+  uint8_t val;
+  long i;
+
+  for (i = 0; i < READS; i++)
+  {
+    lock(NULL, I3G4250D_LOCK_BUS);
+    val = priv.ctrl_reg[0];
+    unlock(NULL, I3G4250D_LOCK_BUS);
+  }
+
+  (void)val;
+  return (now_ns() - t0) / (double)READS;
+}
+
+static void run(const char *label, int with_writer)
+{
+  pthread_t wr;
+  double lf;
+  double lk;
+
+  __atomic_store_n(&stop, 0, __ATOMIC_RELEASE);
+  if (with_writer != 0)
+  {
+    (void)pthread_create(&wr, NULL, writer, NULL);
+  }
+
+  lf = lock_free_reads();
+  lk = locked_reads();
+
+  if (with_writer != 0)
+  {
+    __atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+    (void)pthread_join(wr, NULL);
+  }
+
+  (void)printf("%-24s lock-free %6.1f ns/read, bus lock %6.1f ns/read\n",
+               label, lf, lk);
+}
+
+int main(void)
+{
+  i3g4250d_lock_t locks = { lock, unlock, NULL };
+
+  (void)i3g4250d_lock_set(&ctx, &locks);
+  (void)i3g4250d_data_rate_set(&ctx, I3G4250D_ODR_100Hz);
+
+  run("idle bus:", 0);
+  run("concurrent writer:", 1);
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ ******************************************************************************
+ * @file    bench_soa.c
+ * @brief   Time per FIFO block of 32 samples, on an in-memory bus: the
+ *          burst alone, the X Y Z interleaved read followed by a separate
+ *          deinterleave pass, and the read into X, Y, Z lanes. Built once
+ *          with the vector deinterleave and once with the scalar one.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_reg.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BLOCKS  2000000L
+
+static uint8_t fifo[I3G4250D_FIFO_DEPTH * 6U];
+
+static int32_t bus_read(void *handle, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
+{
+  (void)handle;
+  (void)reg;
+  (void)memcpy(buf, fifo, len);
+  return 0;
+}
+
+static int32_t bus_write(void *handle, uint8_t reg, const uint8_t *buf,
+                         uint16_t len)
+{
+  (void)handle;
+  (void)reg;
+  (void)buf;
+  (void)len;
+  return 0;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void run(const stmdev_ctx_t *ctx, const char *order)
+{
+  static int16_t val[3U * I3G4250D_FIFO_DEPTH];
+  static int16_t x[I3G4250D_FIFO_DEPTH];
+  static int16_t y[I3G4250D_FIFO_DEPTH];
+  static int16_t z[I3G4250D_FIFO_DEPTH];
+  static i3g4250d_fifo_soa_t blk;
+  double t0;
+  double tb;
+  double ta;
+  double ts;
+  long b;
+  uint8_t n;
+
+  t0 = now_ns();
+  for (b = 0; b < BLOCKS; b++)
+  {
+    (void)i3g4250d_read_reg(ctx, I3G4250D_OUT_X_L, (uint8_t *)val,
+                            sizeof(val));
+  }
+  tb = now_ns() - t0;
+
+  t0 = now_ns();
+  for (b = 0; b < BLOCKS; b++)
+  {
+    (void)i3g4250d_fifo_angular_rate_raw_get(ctx, val, 32U);
+    for (n = 0U; n < 32U; n++)
+    {
+      x[n] = val[3U * n];
+      y[n] = val[(3U * n) + 1U];
+      z[n] = val[(3U * n) + 2U];
+    }
+  }
+  ta = now_ns() - t0;
+
+  t0 = now_ns();
+  for (b = 0; b < BLOCKS; b++)
+  {
+    (void)i3g4250d_fifo_angular_rate_raw_soa_get(ctx, &blk, 32U);
+  }
+  ts = now_ns() - t0;
+
+  (void)printf("%s, %s: burst %5.1f ns, interleaved + pass %5.1f ns,"
+               " lanes %5.1f ns per block (%d %d %d)\n",
+               (I3G4250D_SOA_SIMD != 0) ? "vector" : "scalar", order,
+               tb / BLOCKS, ta / BLOCKS, ts / BLOCKS,
+               x[31] + y[31] + z[31], blk.x[31], blk.z[31]);
+}
+
+int main(void)
+{
+  i3g4250d_priv_t priv;
+  stmdev_ctx_t ctx;
+  uint16_t i;
+
+  for (i = 0U; i < sizeof(fifo); i++)
+  {
+    fifo[i] = (uint8_t)(i * 37U);
+  }
+
+  (void)memset(&priv, 0, sizeof(priv));
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = bus_read;
+  ctx.write_reg = bus_write;
+  ctx.priv_data = &priv;
+
+  (void)i3g4250d_data_format_set(&ctx, I3G4250D_AUX_LSB_AT_LOW_ADD);
+  run(&ctx, "host byte order   ");
+  (void)i3g4250d_data_format_set(&ctx, I3G4250D_AUX_MSB_AT_LOW_ADD);
+  run(&ctx, "swapped byte order");
+
+  return 0;
+}
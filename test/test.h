@@ -0,0 +1,69 @@
+/*
+ ******************************************************************************
+ * @file    test.h
+ * @brief   Minimal checks shared by the i3g4250d host tests.
+ ******************************************************************************
+ */
+
+#ifndef I3G4250D_TEST_H
+#define I3G4250D_TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "i3g4250d_reg.h"
+
+static int test_failures;
+
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__,    \
+                   #cond);                                              \
+      test_failures++;                                                  \
+    }                                                                   \
+  } while (0)
+
+#define TEST_END()                                                      \
+  do {                                                                  \
+    (void)printf("%s: %s\n", __FILE__,                                  \
+                 (test_failures == 0) ? "ok" : "FAILED");               \
+    return (test_failures == 0) ? 0 : 1;                                \
+  } while (0)
+
+/* in-memory recording of num samples, one per block, at the rate of
+   ctrl_reg1 with FIFO enabled in stream mode; returns its size */
+static inline uint32_t test_recording(uint64_t *buf, uint32_t size,
+                                      const int16_t *val, uint16_t num,
+                                      uint8_t ctrl_reg1, uint32_t period_us)
+{
+  i3g4250d_rec_header_t hdr;
+  i3g4250d_rec_writer_t w;
+  uint16_t n;
+
+  (void)memset(&hdr, 0, sizeof(hdr));
+  hdr.version = I3G4250D_REC_VERSION;
+  hdr.block_len = 1U;
+  hdr.ctrl_reg[0] = ctrl_reg1;
+  hdr.ctrl_reg[4] = 0x40U;    /* FIFO_EN */
+  hdr.fifo_ctrl = 0x40U;      /* stream mode */
+
+  if (i3g4250d_rec_writer_init(&w, (uint8_t *)buf, size, NULL, NULL,
+                               &hdr) != 0)
+  {
+    return 0U;
+  }
+
+  for (n = 0U; n < num; n++)
+  {
+    if (i3g4250d_rec_write(&w, &val[3U * n], 1U, n,
+                           (uint64_t)n * period_us) != 0)
+    {
+      return 0U;
+    }
+  }
+
+  return w.used;
+}
+
+#endif /* I3G4250D_TEST_H */
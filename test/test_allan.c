@@ -0,0 +1,109 @@
+/*
+ ******************************************************************************
+ * @file    test_allan.c
+ * @brief   Allan variance of a recording processed in chunks and merged
+ *          against the same recording processed sequentially.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_avar.h"
+#include "test.h"
+#include <stdlib.h>
+
+#define SAMPLES 150000U
+
+static int16_t rec[3U * SAMPLES];
+
+static void check_same(const i3g4250d_avar_t *a, const i3g4250d_avar_t *b)
+{
+  uint8_t l;
+  uint8_t x;
+
+  CHECK(a->samples == b->samples);
+  for (x = 0U; x < 3U; x++)
+  {
+    CHECK(a->phase[x] == b->phase[x]);
+  }
+
+  for (l = 0U; l < I3G4250D_AVAR_LEVELS; l++)
+  {
+    CHECK(a->lvl[l].terms == b->lvl[l].terms);
+    CHECK(a->lvl[l].len == b->lvl[l].len);
+    for (x = 0U; x < 3U; x++)
+    {
+      CHECK(a->lvl[l].d2[x] == b->lvl[l].d2[x]);
+    }
+  }
+}
+
+/* process rec in chunks ending at cut[], then merge them left to right */
+static void chunked(i3g4250d_avar_t *dst, const uint32_t *cut,
+                    uint32_t num)
+{
+  static i3g4250d_avar_t part;
+  uint32_t from = 0U;
+  uint32_t i;
+
+  i3g4250d_avar_init(dst, 800.0f, 70.0f);
+  for (i = 0U; i <= num; i++)
+  {
+    uint32_t to = (i < num) ? cut[i] : SAMPLES;
+
+    i3g4250d_avar_chunk_init(&part, 800.0f, 70.0f, from);
+    i3g4250d_avar_update(&part, &rec[3U * from], to - from);
+    CHECK(i3g4250d_avar_merge(dst, &part) == 0);
+    from = to;
+  }
+}
+
+int main(void)
+{
+  static i3g4250d_avar_t seq;
+  static i3g4250d_avar_t par;
+  static i3g4250d_avar_t part;
+  static const uint32_t aligned[] = { 32768U, 65536U, 98304U };
+  static const uint32_t odd[] = { 1U, 7U, 1000U, 40961U, 40962U, 99999U };
+  uint32_t cut[16];
+  uint32_t i;
+  uint32_t n;
+
+  srand(1U);
+  for (i = 0U; i < (3U * SAMPLES); i++)
+  {
+    /* bias plus noise, small enough for exact sums of squares */
+    rec[i] = (int16_t)(20 + (rand() % 41) - 20);
+  }
+
+  i3g4250d_avar_init(&seq, 800.0f, 70.0f);
+  i3g4250d_avar_update(&seq, rec, SAMPLES);
+
+  chunked(&par, aligned, 3U);
+  check_same(&seq, &par);
+
+  chunked(&par, odd, 6U);
+  check_same(&seq, &par);
+
+  for (n = 0U; n < 20U; n++)
+  {
+    cut[0] = 0U;
+    for (i = 1U; i < 16U; i++)
+    {
+      cut[i] = cut[i - 1U] + ((uint32_t)rand() % (SAMPLES / 16U));
+    }
+
+    chunked(&par, cut, 16U);
+    check_same(&seq, &par);
+  }
+
+  /* a chunk that doesn't follow dst is rejected, dst left as it was */
+  chunked(&par, aligned, 3U);
+  i3g4250d_avar_chunk_init(&part, 800.0f, 70.0f, SAMPLES + 1U);
+  i3g4250d_avar_update(&part, rec, 100U);
+  CHECK(i3g4250d_avar_merge(&par, &part) == -1);
+  check_same(&seq, &par);
+
+  i3g4250d_avar_chunk_init(&part, 400.0f, 70.0f, SAMPLES);
+  CHECK(i3g4250d_avar_merge(&par, &part) == -1);
+
+  TEST_END();
+}
@@ -0,0 +1,115 @@
+/*
+ ******************************************************************************
+ * @file    test_autorange.c
+ * @brief   Full scale tags of the autoranger across consecutive switches,
+ *          with the FIFO level served by the replay transport.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_reg.h"
+#include "test.h"
+
+#define PERIOD_US 10000U      /* CTRL_REG1 0x0F: 100 Hz */
+#define SAMPLES   64U
+
+static uint64_t rec[(16U + (SAMPLES * 24U)) / 8U];
+static int16_t zero[3U * SAMPLES];
+static uint64_t clk;
+
+static uint64_t now_us(void)
+{
+  return clk;
+}
+
+/* read n samples out of the emulated FIFO, as a drain would */
+static void drain(const stmdev_ctx_t *ctx, uint8_t n)
+{
+  int16_t raw[3];
+
+  while (n-- > 0U)
+  {
+    CHECK(i3g4250d_angular_rate_raw_get(ctx, raw) == 0);
+  }
+}
+
+static void block(const stmdev_ctx_t *ctx, i3g4250d_autorange_t *ar,
+                  int16_t v, uint16_t num, i3g4250d_fs_t *fs)
+{
+  int16_t val[3U * 8U];
+  uint16_t i;
+
+  for (i = 0U; i < (3U * num); i++)
+  {
+    val[i] = v;
+  }
+
+  CHECK(i3g4250d_autorange_update(ctx, ar, val, num, fs) == 0);
+}
+
+int main(void)
+{
+  static const i3g4250d_autorange_cfg_t cfg = { 30000U, 20000U, 1000U };
+  i3g4250d_replay_t rp;
+  i3g4250d_autorange_t ar;
+  stmdev_ctx_t ctx;
+  i3g4250d_fs_t fs[8];
+  uint32_t len;
+  uint8_t i;
+
+  len = test_recording(rec, sizeof(rec), zero, SAMPLES, 0x0FU, PERIOD_US);
+  CHECK(len > 0U);
+  CHECK(i3g4250d_replay_init(&rp, (const uint8_t *)rec, len, now_us) == 0);
+
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = i3g4250d_replay_read;
+  ctx.write_reg = i3g4250d_replay_write;
+  ctx.handle = &rp;
+
+  clk = 0U;
+  CHECK(i3g4250d_autorange_init(&ctx, &ar, &cfg, I3G4250D_2000dps) == 0);
+  drain(&ctx, 1U);
+
+  /* 10 samples at 2000 dps queued when a quiet block steps down */
+  clk = 10U * PERIOD_US;
+  ar.cfg.hold = 1U;
+  block(&ctx, &ar, 0, 1U, fs);
+  CHECK(fs[0] == I3G4250D_2000dps);
+  CHECK(i3g4250d_autorange_fs_get(&ar) == I3G4250D_500dps);
+
+  /* 8 drained, only 4 of them reach the autoranger */
+  ar.cfg.hold = 1000U;
+  drain(&ctx, 8U);
+  block(&ctx, &ar, 100, 4U, fs);
+  for (i = 0U; i < 4U; i++)
+  {
+    CHECK(fs[i] == I3G4250D_2000dps);
+  }
+
+  /* 2 left in FIFO when stepping down again */
+  ar.cfg.hold = 1U;
+  block(&ctx, &ar, 0, 1U, fs);
+  CHECK(fs[0] == I3G4250D_2000dps);
+  CHECK(i3g4250d_autorange_fs_get(&ar) == I3G4250D_245dps);
+
+  ar.cfg.hold = 1000U;
+  drain(&ctx, 2U);
+  block(&ctx, &ar, 100, 2U, fs);
+  CHECK((fs[0] == I3G4250D_2000dps) && (fs[1] == I3G4250D_2000dps));
+
+  /* 3 samples at 245 dps queued when a clipping block steps up: the
+     tags of the samples already read out must not leak into theirs */
+  clk = 13U * PERIOD_US;
+  block(&ctx, &ar, 32000, 1U, fs);
+  CHECK(fs[0] == I3G4250D_245dps);
+  CHECK(i3g4250d_autorange_fs_get(&ar) == I3G4250D_500dps);
+
+  drain(&ctx, 3U);
+  block(&ctx, &ar, 100, 4U, fs);
+  for (i = 0U; i < 3U; i++)
+  {
+    CHECK(fs[i] == I3G4250D_245dps);
+  }
+  CHECK(fs[3] == I3G4250D_500dps);
+
+  TEST_END();
+}
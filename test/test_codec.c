@@ -0,0 +1,110 @@
+/*
+ ******************************************************************************
+ * @file    test_codec.c
+ * @brief   Block codec round trip, size bound and CRC checks.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_codec.h"
+#include "test.h"
+#include <stdlib.h>
+
+#define MAX 512U
+
+static int16_t val[3U * MAX];
+static int16_t dec[3U * MAX];
+static uint8_t enc[I3G4250D_CODEC_MAX_SIZE(MAX)];
+
+/* bitwise CRC-16/CCITT reference */
+static uint16_t crc_ref(const uint8_t *buf, uint32_t len)
+{
+  uint16_t crc = 0xFFFFU;
+  uint32_t i;
+  uint8_t b;
+
+  for (i = 0U; i < len; i++)
+  {
+    crc ^= (uint16_t)(buf[i] << 8);
+    for (b = 0U; b < 8U; b++)
+    {
+      crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) :
+            (uint16_t)(crc << 1);
+    }
+  }
+
+  return crc;
+}
+
+static void round_trip(uint16_t num)
+{
+  uint32_t len;
+  uint16_t got = 0xFFFFU;
+  uint16_t crc;
+
+  len = i3g4250d_codec_encode(val, num, enc);
+  CHECK(len <= I3G4250D_CODEC_MAX_SIZE(num));
+
+  crc = (uint16_t)(enc[len - 2U] | (enc[len - 1U] << 8));
+  CHECK(crc == crc_ref(enc, len - 2U));
+
+  CHECK(i3g4250d_codec_decode(enc, len, dec, num, &got) == 0);
+  CHECK(got == num);
+  CHECK(memcmp(val, dec, 6U * num) == 0);
+}
+
+int main(void)
+{
+  uint32_t len;
+  uint32_t bit;
+  uint32_t i;
+  uint16_t got;
+  uint16_t num;
+  int noise;
+
+  CHECK(crc_ref((const uint8_t *)"123456789", 9U) == 0x29B1U);
+
+  /* random walks of several amplitudes, every block length */
+  srand(1U);
+  for (noise = 1; noise <= 65536; noise *= 16)
+  {
+    for (num = 0U; num <= MAX; num = (uint16_t)((num < 40U) ? num + 1U :
+                                                 num * 2U))
+    {
+      for (i = 0U; i < (3U * num); i++)
+      {
+        val[i] = (int16_t)((rand() % noise) - (noise / 2));
+      }
+      round_trip(num);
+    }
+  }
+
+  /* full-scale steps need the 17-bit width */
+  for (i = 0U; i < (3U * MAX); i++)
+  {
+    val[i] = ((i / 3U) & 1U) ? INT16_MAX : INT16_MIN;
+  }
+  round_trip((uint16_t)MAX);
+  CHECK(enc[8] == 17U);
+
+  /* every single bit error is detected */
+  for (i = 0U; i < (3U * 32U); i++)
+  {
+    val[i] = (int16_t)(rand() % 64);
+  }
+  len = i3g4250d_codec_encode(val, 32U, enc);
+  for (bit = 0U; bit < (8U * len); bit++)
+  {
+    enc[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+    CHECK(i3g4250d_codec_decode(enc, len, dec, MAX, &got) == -1);
+    enc[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+  }
+
+  /* truncated block, too many samples, bad width */
+  CHECK(i3g4250d_codec_decode(enc, len - 1U, dec, MAX, &got) == -1);
+  CHECK(i3g4250d_codec_decode(enc, 5U, dec, MAX, &got) == -1);
+  CHECK(i3g4250d_codec_decode(enc, len, dec, 31U, &got) == -1);
+  enc[8] = 18U;
+  CHECK(i3g4250d_codec_decode(enc, len, dec, MAX, &got) == -1);
+
+  TEST_END();
+}
@@ -0,0 +1,183 @@
+/*
+ ******************************************************************************
+ * @file    test_coro.cpp
+ * @brief   C++20 awaiters of i3g4250d_coro.hpp on the simulated transport
+ *          (deferred completions) over a replay instance, with completions
+ *          delivered inline, and with requests that can't be issued.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_coro.hpp"
+#include "test.h"
+
+#define SAMPLES 40U
+
+static uint64_t rec[(16U + (SAMPLES * 24U)) / 8U];
+static int16_t val[3U * SAMPLES];
+static i3g4250d_replay_t rp;
+static stmdev_ctx_t ctx;
+
+/* eager coroutine, kept until destroyed by the test */
+struct task
+{
+  struct promise_type
+  {
+    bool done = false;
+
+    task get_return_object()
+    {
+      return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept
+    {
+      done = true;
+      return {};
+    }
+    void return_void() {}
+    void unhandled_exception() {}
+  };
+
+  std::coroutine_handle<promise_type> h;
+
+  bool done() const { return h.promise().done; }
+  ~task() { h.destroy(); }
+};
+
+struct result
+{
+  int32_t modify = 1;
+  uint8_t data = 0U;
+  int32_t drained = 0;
+  int32_t read = 1;
+  uint8_t who = 0U;
+};
+
+static task sequence(const i3g4250d_async_if_t *bus, int16_t *buf,
+                     result *res)
+{
+  i3g4250d::modify_reg mod(&ctx, bus, I3G4250D_CTRL_REG4, 0x30U, 0x10U);
+
+  res->modify = co_await mod;
+  res->data = mod.data();
+  res->drained = co_await i3g4250d::fifo_drain(&ctx, bus, buf, 32U);
+  res->read = co_await i3g4250d::read_reg(&ctx, bus, I3G4250D_WHO_AM_I,
+                                          &res->who, 1U);
+}
+
+/* completions delivered from within the request */
+static int32_t inline_read(void *handle, uint8_t reg, uint8_t *buf,
+                           uint16_t len, i3g4250d_async_done_t done,
+                           void *arg)
+{
+  done(arg, ctx.read_reg(handle, reg, buf, len));
+  return 0;
+}
+
+static int32_t inline_write(void *handle, uint8_t reg, uint8_t *buf,
+                            uint16_t len, i3g4250d_async_done_t done,
+                            void *arg)
+{
+  done(arg, ctx.write_reg(handle, reg, buf, len));
+  return 0;
+}
+
+/* simulated transport refusing the second request */
+static i3g4250d_async_sim_t sim;
+static int requests;
+
+static int32_t refuse_read(void *handle, uint8_t reg, uint8_t *buf,
+                           uint16_t len, i3g4250d_async_done_t done,
+                           void *arg)
+{
+  if (++requests == 2) { return -1; }
+  return i3g4250d_async_sim_read(handle, reg, buf, len, done, arg);
+}
+
+static void reset(void)
+{
+  uint32_t len;
+
+  len = test_recording(rec, sizeof(rec), val, SAMPLES, 0x0FU, 10000U);
+  CHECK(i3g4250d_replay_init(&rp, (const uint8_t *)rec, len, NULL) == 0);
+}
+
+int main(void)
+{
+  int16_t buf[3U * 32U];
+  i3g4250d_async_if_t bus;
+  uint32_t polls = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < (3U * SAMPLES); i++)
+  {
+    val[i] = (int16_t)(i * 7U);
+  }
+
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = i3g4250d_replay_read;
+  ctx.write_reg = i3g4250d_replay_write;
+  ctx.handle = &rp;
+
+  /* deferred completions: one poll per transfer */
+  reset();
+  i3g4250d_async_sim_init(&sim, &ctx, &bus);
+  {
+    result res;
+    task t = sequence(&bus, buf, &res);
+
+    while (i3g4250d_async_sim_poll(&sim) != 0U) { polls++; }
+    CHECK(t.done());
+    CHECK(polls == 5U);
+    CHECK((res.modify == 0) && (res.data == 0x10U));
+    CHECK(rp.regs[I3G4250D_CTRL_REG4] == 0x10U);
+    CHECK(res.drained == 31);
+    CHECK(memcmp(buf, val, 31U * 6U) == 0);
+    CHECK((res.read == 0) && (res.who == I3G4250D_ID));
+  }
+
+  /* completions from within the requests: no suspension at all */
+  reset();
+  bus.read = inline_read;
+  bus.write = inline_write;
+  bus.handle = &rp;
+  {
+    result res;
+    task t = sequence(&bus, buf, &res);
+
+    CHECK(t.done());
+    CHECK((res.modify == 0) && (res.drained == 31) && (res.read == 0));
+    CHECK(memcmp(buf, val, 31U * 6U) == 0);
+  }
+
+  /* FIFO_SRC read completes, the samples burst can't be issued */
+  reset();
+  i3g4250d_async_sim_init(&sim, &ctx, &bus);
+  bus.read = refuse_read;
+  {
+    i3g4250d_fifo_drain_op_t op;
+    int32_t status = 1;
+
+    CHECK(i3g4250d_fifo_drain_async(&op, &ctx, &bus, buf, 32U,
+                                    [](void *arg, int32_t st)
+                                    { *static_cast<int32_t *>(arg) = st; },
+                                    &status) == 0);
+    CHECK(i3g4250d_async_sim_poll(&sim) == 1U);
+    CHECK((status == -1) && (op.status == -1) && (op.num == 0U));
+  }
+
+  /* a request that can't be issued resumes at once with its status */
+  requests = 1;
+  {
+    result res;
+    task t = sequence(&bus, buf, &res);
+
+    CHECK(!t.done());
+    CHECK(res.modify == -1);
+    while (i3g4250d_async_sim_poll(&sim) != 0U) { }
+    CHECK(t.done());
+    CHECK((res.drained == 31) && (res.read == 0));
+  }
+
+  TEST_END();
+}
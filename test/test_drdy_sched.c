@@ -0,0 +1,128 @@
+/*
+ ******************************************************************************
+ * @file    test_drdy_sched.c
+ * @brief   Data-ready scheduler on the replay transport: the real sample
+ *          period is learned from a recording whose clock runs off the
+ *          nominal rate, with jitter. Once learned, every sample is read
+ *          before the next one would overwrite it in bypass mode.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_reg.h"
+#include "test.h"
+#include <stdlib.h>
+
+#define SAMPLES 3000U
+#define START   5000000U      /* scheduler time of the first sample */
+
+static uint64_t rec[(16U + (SAMPLES * 24U)) / 8U];
+static int16_t val[3U * SAMPLES];
+static uint64_t ts[SAMPLES];
+static uint64_t clk;
+
+static uint64_t now_us(void)
+{
+  return clk;
+}
+
+/* recording at 100 Hz nominal, real period "period_us" +/- "jitter_us" */
+static uint32_t recording(uint32_t period_us, uint32_t jitter_us)
+{
+  i3g4250d_rec_header_t hdr;
+  i3g4250d_rec_writer_t w;
+  uint16_t n;
+
+  (void)memset(&hdr, 0, sizeof(hdr));
+  hdr.version = I3G4250D_REC_VERSION;
+  hdr.block_len = 1U;
+  hdr.ctrl_reg[0] = 0x0FU;
+  CHECK(i3g4250d_rec_writer_init(&w, (uint8_t *)rec, sizeof(rec), NULL,
+                                 NULL, &hdr) == 0);
+
+  for (n = 0U; n < SAMPLES; n++)
+  {
+    val[3U * n] = (int16_t)n;
+    ts[n] = ((uint64_t)n * period_us) + 1000U;
+    if (jitter_us > 0U)
+    {
+      ts[n] += (uint32_t)(rand() % (int)(2U * jitter_us));
+      ts[n] -= jitter_us;
+    }
+    CHECK(i3g4250d_rec_write(&w, &val[3U * n], 1U, n, ts[n]) == 0);
+  }
+
+  return w.used;
+}
+
+static void run(uint32_t period_us, uint32_t jitter_us)
+{
+  static i3g4250d_replay_t rp;
+  i3g4250d_drdy_sched_t sch;
+  stmdev_ctx_t ctx;
+  int16_t raw[3];
+  uint64_t delay;
+  uint64_t max_delay = 0U;
+  uint32_t expected = 0U;
+  uint32_t lost = 0U;
+  uint32_t n;
+  uint8_t ready;
+  float_t period;
+
+  CHECK(i3g4250d_replay_init(&rp, (const uint8_t *)rec,
+                             recording(period_us, jitter_us), now_us) == 0);
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = i3g4250d_replay_read;
+  ctx.write_reg = i3g4250d_replay_write;
+  ctx.handle = &rp;
+
+  clk = START;
+  CHECK(i3g4250d_drdy_sched_init(&ctx, &sch, clk) == 0);
+  CHECK(i3g4250d_drdy_sched_period_get(&sch) == 10000.0f);
+
+  while ((expected < (SAMPLES - 1U)) && (sch.polls < (4U * SAMPLES)))
+  {
+    clk = i3g4250d_drdy_sched_next_get(&sch);
+    CHECK(i3g4250d_drdy_sched_poll(&ctx, &sch, clk, raw, &ready) == 0);
+
+    if (ready != 0U)
+    {
+      n = (uint32_t)(uint16_t)raw[0];
+      CHECK(n == expected);
+      expected = n + 1U;
+
+      /* the replay queues late samples, the device would overwrite them;
+         its clock starts at the first timestamp */
+      if (n > 100U)
+      {
+        lost += ((clk - START + ts[0]) >= ts[n + 1U]) ? 1U : 0U;
+        delay = (clk - START + ts[0]) - ts[n];
+        max_delay = (delay > max_delay) ? delay : max_delay;
+      }
+    }
+  }
+
+  period = i3g4250d_drdy_sched_period_get(&sch);
+  (void)printf("  period %5u us, jitter %3u us: learned %.1f us, "
+               "%u polls, %u misses, max delay %u us\n", period_us,
+               jitter_us, (double)period, sch.polls, sch.misses,
+               (uint32_t)max_delay);
+
+  CHECK(lost == 0U);
+  CHECK(max_delay <= (3U * jitter_us) + 10U);
+  CHECK(sch.samples == (SAMPLES - 1U));
+  CHECK((period > ((float_t)period_us * 0.995f)) &&
+        (period < ((float_t)period_us * 1.005f)));
+  /* polls per sample stay bounded by the guard adaptation */
+  CHECK(sch.polls < ((jitter_us > 0U) ? (3U * SAMPLES) : (2U * SAMPLES)));
+}
+
+int main(void)
+{
+  srand(1U);
+  run(10000U, 0U);
+  run(10300U, 0U);
+  run(9700U, 0U);
+  run(10300U, 200U);
+
+  TEST_END();
+}
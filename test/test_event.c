@@ -0,0 +1,165 @@
+/*
+ ******************************************************************************
+ * @file    test_event.c
+ * @brief   FIFO watermark delivery through epoll, with eventfd standing
+ *          for the GPIO lines: several devices in one set, drain and
+ *          acknowledge, overrun, bus errors, idle timeout and removal.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_linux.h"
+#include "test.h"
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#define DEVS  3U
+
+typedef struct
+{
+  uint32_t pending;         /* samples in the emulated FIFO */
+  uint32_t reads;
+  int fail;
+  uint8_t seed;
+} fake_t;
+
+typedef struct
+{
+  uint32_t calls;
+  uint32_t samples;
+  int16_t first;
+} sink_t;
+
+static fake_t fake[DEVS];
+static sink_t sink[DEVS];
+
+static int32_t bus_read(void *handle, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
+{
+  fake_t *f = (fake_t *)handle;
+  uint16_t i;
+
+  f->reads++;
+  if (f->fail != 0) { return -1; }
+
+  if ((reg & 0x3FU) == I3G4250D_FIFO_SRC_REG)
+  {
+    buf[0] = (f->pending == 0U) ? 0x20U :                 /* EMPTY */
+             (f->pending >= I3G4250D_FIFO_DEPTH) ? 0x40U : /* OVRN */
+             (uint8_t)f->pending;
+  }
+  else
+  {
+    for (i = 0U; i < len; i++)
+    {
+      buf[i] = (uint8_t)(f->seed + i);
+    }
+    f->pending -= len / 6U;
+  }
+
+  return 0;
+}
+
+static int32_t bus_write(void *handle, uint8_t reg, const uint8_t *buf,
+                         uint16_t len)
+{
+  (void)handle;
+  (void)reg;
+  (void)buf;
+  (void)len;
+  return 0;
+}
+
+static void consume(void *user, const int16_t *val, uint8_t num)
+{
+  sink_t *s = (sink_t *)user;
+
+  s->calls++;
+  s->samples += num;
+  s->first = val[0];
+}
+
+static void signal_line(const i3g4250d_linux_dev_t *dev, uint32_t samples,
+                        fake_t *f)
+{
+  uint64_t one = 1U;
+
+  f->pending += samples;
+  (void)write(dev->fd, &one, sizeof(one));
+}
+
+int main(void)
+{
+  static i3g4250d_linux_dev_t dev[DEVS];
+  stmdev_ctx_t ctx[DEVS];
+  uint32_t d;
+  int epfd;
+
+  epfd = epoll_create1(0);
+  CHECK(epfd >= 0);
+
+  for (d = 0U; d < DEVS; d++)
+  {
+    (void)memset(&ctx[d], 0, sizeof(ctx[d]));
+    ctx[d].read_reg = bus_read;
+    ctx[d].write_reg = bus_write;
+    ctx[d].handle = &fake[d];
+    fake[d].seed = (uint8_t)(0x10U * d);
+
+    dev[d].ctx = &ctx[d];
+    dev[d].consume = consume;
+    dev[d].user = &sink[d];
+    dev[d].fd = eventfd(0U, EFD_NONBLOCK);
+    CHECK(dev[d].fd >= 0);
+    CHECK(i3g4250d_linux_event_add(epfd, &dev[d]) == 0);
+  }
+  CHECK(i3g4250d_linux_event_add(epfd, &dev[0]) == -1);   /* twice */
+
+  /* idle: nothing ready, no bus transfer */
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 0) == 0);
+  CHECK((fake[0].reads + fake[1].reads + fake[2].reads) == 0U);
+
+  /* two of three devices signalled: each drained once, acknowledged */
+  signal_line(&dev[0], 20U, &fake[0]);
+  signal_line(&dev[2], 8U, &fake[2]);
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 100) == 2);
+  CHECK((sink[0].calls == 1U) && (sink[0].samples == 20U));
+  CHECK((sink[1].calls == 0U) && (sink[2].samples == 8U));
+  CHECK(sink[2].first == (int16_t)0x2120);
+  CHECK((fake[0].pending == 0U) && (fake[2].pending == 0U));
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 0) == 0);
+
+  /* event counted several times before the dispatch: one drain */
+  signal_line(&dev[1], 5U, &fake[1]);
+  signal_line(&dev[1], 5U, &fake[1]);
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 100) == 1);
+  CHECK((sink[1].calls == 1U) && (sink[1].samples == 10U));
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 0) == 0);
+
+  /* overrun: the FIFO is read a second time */
+  signal_line(&dev[0], 40U, &fake[0]);
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 100) == 1);
+  CHECK((sink[0].calls == 3U) && (sink[0].samples == 60U));
+
+  /* bus error: counted, event still acknowledged */
+  fake[2].fail = 1;
+  signal_line(&dev[2], 8U, &fake[2]);
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 100) == 1);
+  CHECK((dev[2].errors == 1U) && (sink[2].calls == 1U));
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 0) == 0);
+  fake[2].fail = 0;
+
+  /* removed device: no longer handled */
+  CHECK(i3g4250d_linux_event_del(epfd, &dev[1]) == 0);
+  signal_line(&dev[1], 5U, &fake[1]);
+  CHECK(i3g4250d_linux_event_dispatch(epfd, 0) == 0);
+  CHECK(sink[1].calls == 1U);
+
+  for (d = 0U; d < DEVS; d++)
+  {
+    (void)close(dev[d].fd);
+  }
+  (void)close(epfd);
+
+  TEST_END();
+}
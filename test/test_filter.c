@@ -0,0 +1,186 @@
+/*
+ ******************************************************************************
+ * @file    test_filter.c
+ * @brief   Post-filters on four-lane state against straightforward three
+ *          axis references: biquad cascade, moving average (window
+ *          filling and wrap) and CIC decimator, over several blocks.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_filter.h"
+#include "test.h"
+#include <stdlib.h>
+
+#define NUM    500U
+#define BLOCK  37U
+
+static int16_t in[3U * NUM];
+static float_t out[3U * NUM];
+static float_t ref[3U * NUM];
+
+static void ref_biquad(const i3g4250d_biquad_coef_t *c, uint8_t stages)
+{
+  float_t z1[I3G4250D_BIQUAD_MAX_STAGES][3] = { { 0.0f } };
+  float_t z2[I3G4250D_BIQUAD_MAX_STAGES][3] = { { 0.0f } };
+  float_t x;
+  float_t y;
+  uint32_t n;
+  uint8_t s;
+  uint8_t a;
+
+  for (n = 0U; n < NUM; n++)
+  {
+    for (a = 0U; a < 3U; a++)
+    {
+      x = (float_t)in[(3U * n) + a];
+      for (s = 0U; s < stages; s++)
+      {
+        y = (c[s].b0 * x) + z1[s][a];
+        z1[s][a] = (c[s].b1 * x) - (c[s].a1 * y) + z2[s][a];
+        z2[s][a] = (c[s].b2 * x) - (c[s].a2 * y);
+        x = y;
+      }
+      ref[(3U * n) + a] = x;
+    }
+  }
+}
+
+static void ref_mavg(uint8_t len)
+{
+  int32_t sum;
+  uint32_t n;
+  uint32_t k;
+  uint32_t cnt;
+  uint8_t a;
+
+  for (n = 0U; n < NUM; n++)
+  {
+    cnt = ((n + 1U) < len) ? (n + 1U) : len;
+    for (a = 0U; a < 3U; a++)
+    {
+      sum = 0;
+      for (k = 0U; k < cnt; k++)
+      {
+        sum += in[(3U * (n - k)) + a];
+      }
+      ref[(3U * n) + a] = (float_t)sum * (1.0f / (float_t)cnt);
+    }
+  }
+}
+
+/* CIC of order N, ratio R = boxcar of length R applied N times,
+   decimated; returns the number of outputs */
+static uint32_t ref_cic(uint8_t order, uint16_t rate)
+{
+  static int64_t stage[2][3U * NUM];
+  int64_t gain = 1;
+  uint32_t produced = 0U;
+  uint32_t n;
+  uint32_t k;
+  uint8_t s;
+  uint8_t a;
+
+  for (n = 0U; n < (3U * NUM); n++)
+  {
+    stage[0][n] = in[n];
+  }
+
+  for (s = 0U; s < order; s++)
+  {
+    gain *= rate;
+    for (n = 0U; n < NUM; n++)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        stage[1][(3U * n) + a] = 0;
+        for (k = 0U; (k < rate) && (k <= n); k++)
+        {
+          stage[1][(3U * n) + a] += stage[0][(3U * (n - k)) + a];
+        }
+      }
+    }
+    (void)memcpy(stage[0], stage[1], sizeof(stage[0]));
+  }
+
+  for (n = rate - 1U; n < NUM; n += rate)
+  {
+    for (a = 0U; a < 3U; a++)
+    {
+      ref[(3U * produced) + a] = (float_t)stage[0][(3U * n) + a] *
+                                 (1.0f / (float_t)gain);
+    }
+    produced++;
+  }
+
+  return produced;
+}
+
+static uint32_t mismatches(uint32_t words)
+{
+  uint32_t bad = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < words; i++)
+  {
+    bad += (out[i] != ref[i]) ? 1U : 0U;
+  }
+
+  return bad;
+}
+
+int main(void)
+{
+  i3g4250d_biquad_coef_t coef[2];
+  i3g4250d_biquad_t bq;
+  i3g4250d_mavg_t ma;
+  i3g4250d_cic_t cic;
+  uint32_t produced;
+  uint32_t n;
+
+  srand(7U);
+  for (n = 0U; n < (3U * NUM); n++)
+  {
+    in[n] = (int16_t)((n % 3U) * 1000U) + (int16_t)((rand() % 4001) - 2000);
+  }
+
+  /* biquad cascade: bit exact with the per-axis reference */
+  CHECK(i3g4250d_biquad_coef_get(I3G4250D_BIQUAD_LOW_PASS, 20.0f, 400.0f,
+                                 0.7071f, &coef[0]) == 0);
+  CHECK(i3g4250d_biquad_coef_get(I3G4250D_BIQUAD_HIGH_PASS, 0.5f, 400.0f,
+                                 0.7071f, &coef[1]) == 0);
+  CHECK(i3g4250d_biquad_init(&bq, coef, 2U) == 0);
+  for (n = 0U; n < NUM; n += BLOCK)
+  {
+    i3g4250d_biquad_process(&bq, &in[3U * n], &out[3U * n],
+                            (uint16_t)(((NUM - n) < BLOCK) ? (NUM - n) :
+                                       BLOCK));
+  }
+  ref_biquad(coef, 2U);
+  CHECK(mismatches(3U * NUM) == 0U);
+
+  /* moving average: exact sums, window filling then wrapping */
+  CHECK(i3g4250d_mavg_init(&ma, 16U) == 0);
+  for (n = 0U; n < NUM; n += BLOCK)
+  {
+    i3g4250d_mavg_process(&ma, &in[3U * n], &out[3U * n],
+                          (uint16_t)(((NUM - n) < BLOCK) ? (NUM - n) :
+                                     BLOCK));
+  }
+  ref_mavg(16U);
+  CHECK(mismatches(3U * NUM) == 0U);
+
+  /* CIC decimator: blocks not aligned on the decimation ratio */
+  CHECK(i3g4250d_cic_init(&cic, 3U, 8U) == 0);
+  produced = 0U;
+  for (n = 0U; n < NUM; n += BLOCK)
+  {
+    produced += i3g4250d_cic_process(&cic, &in[3U * n],
+                                     (uint16_t)(((NUM - n) < BLOCK) ?
+                                                (NUM - n) : BLOCK),
+                                     &out[3U * produced]);
+  }
+  CHECK(produced == ref_cic(3U, 8U));
+  CHECK(mismatches(3U * produced) == 0U);
+
+  TEST_END();
+}
@@ -0,0 +1,262 @@
+/*
+ ******************************************************************************
+ * @file    test_linux.c
+ * @brief   Linux bus functions on an ioctl shim emulating an I2C adapter
+ *          with two sensors and a spidev device: one system call per
+ *          register burst through the driver, sub-address bits, batched
+ *          bursts of several sensors, and errors.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_linux.h"
+#include "test.h"
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+
+#define ADDR_A  0x68U
+#define ADDR_B  0x69U
+
+typedef struct
+{
+  uint8_t regs[0x40];
+  uint8_t fifo[I3G4250D_FIFO_DEPTH * 6U];
+  uint8_t ptr;
+  uint8_t inc;
+} sensor_t;
+
+static sensor_t sens[3];            /* A and B on I2C, one on SPI */
+static uint32_t calls;
+static uint32_t segments;
+static int fail;
+
+/* register access at the sensor pointer, FIFO on the output registers */
+static void sensor_io(sensor_t *s, uint8_t *buf, uint32_t len, int rd)
+{
+  uint32_t i;
+  uint32_t f = 0U;
+
+  for (i = 0U; i < len; i++)
+  {
+    if (rd == 0)
+    {
+      s->regs[s->ptr] = buf[i];
+    }
+    else if (s->ptr == I3G4250D_OUT_X_L)
+    {
+      buf[i] = s->fifo[f++ % sizeof(s->fifo)];
+      continue;
+    }
+    else
+    {
+      buf[i] = s->regs[s->ptr];
+    }
+    if (s->inc != 0U)
+    {
+      s->ptr = (uint8_t)((s->ptr + 1U) & 0x3FU);
+    }
+  }
+}
+
+static int i2c_rdwr(struct i2c_rdwr_ioctl_data *xfer)
+{
+  sensor_t *s;
+  uint32_t m;
+
+  for (m = 0U; m < xfer->nmsgs; m++)
+  {
+    struct i2c_msg *msg = &xfer->msgs[m];
+
+    if ((msg->addr != ADDR_A) && (msg->addr != ADDR_B)) { return -1; }
+    s = &sens[msg->addr - ADDR_A];
+    segments++;
+
+    if ((msg->flags & I2C_M_RD) != 0U)
+    {
+      sensor_io(s, msg->buf, msg->len, 1);
+    }
+    else
+    {
+      s->ptr = msg->buf[0] & 0x3FU;
+      s->inc = msg->buf[0] & 0x80U;
+      sensor_io(s, &msg->buf[1], msg->len - 1U, 0);
+    }
+  }
+
+  return (int)xfer->nmsgs;
+}
+
+static int spi_message(struct spi_ioc_transfer *xfer, uint32_t num)
+{
+  sensor_t *s = &sens[2];
+  uint8_t *tx;
+  uint8_t sub = 0U;
+  int start = 1;
+  uint32_t t;
+
+  for (t = 0U; t < num; t++)
+  {
+    segments++;
+    tx = (uint8_t *)(uintptr_t)xfer[t].tx_buf;
+    if (start != 0)
+    {
+      /* first byte after chip select: the sub-address */
+      if (xfer[t].len != 1U) { return -1; }
+      sub = tx[0];
+      s->ptr = sub & 0x3FU;
+      s->inc = sub & 0x40U;
+      start = 0;
+    }
+    else
+    {
+      sensor_io(s, ((sub & 0x80U) != 0U) ?
+                (uint8_t *)(uintptr_t)xfer[t].rx_buf : tx,
+                xfer[t].len, ((sub & 0x80U) != 0U) ? 1 : 0);
+    }
+    if (xfer[t].cs_change != 0U)
+    {
+      start = 1;
+    }
+  }
+
+  return 0;
+}
+
+static int shim(int fd, unsigned long req, void *arg)
+{
+  calls++;
+  if (fail != 0) { return -1; }
+
+  if ((fd == 3) && (req == I2C_RDWR))
+  {
+    return i2c_rdwr((struct i2c_rdwr_ioctl_data *)arg);
+  }
+  if ((fd == 4) && (_IOC_TYPE(req) == SPI_IOC_MAGIC))
+  {
+    return spi_message((struct spi_ioc_transfer *)arg,
+                       _IOC_SIZE(req) / sizeof(struct spi_ioc_transfer));
+  }
+
+  return -1;
+}
+
+int main(void)
+{
+  i3g4250d_linux_bus_t bus[3];
+  i3g4250d_linux_read_t rd[3];
+  i3g4250d_priv_t priv[3];
+  stmdev_ctx_t ctx[3];
+  int16_t val[3U * I3G4250D_FIFO_DEPTH];
+  int16_t val_b[3U * I3G4250D_FIFO_DEPTH];
+  uint8_t status;
+  uint8_t buf[I3G4250D_LINUX_WRITE_MAX + 1U];
+  uint8_t v;
+  uint16_t i;
+  uint8_t d;
+
+  for (d = 0U; d < 3U; d++)
+  {
+    for (i = 0U; i < sizeof(sens[d].fifo); i++)
+    {
+      sens[d].fifo[i] = (uint8_t)((i * 11U) + d);
+    }
+    sens[d].regs[I3G4250D_WHO_AM_I] = I3G4250D_ID;
+
+    i3g4250d_linux_bus_init(&bus[d], (d < 2U) ? 3 : 4,
+                            (uint16_t)(ADDR_A + d));
+    CHECK(bus[d].ioctl == i3g4250d_linux_ioctl);
+    bus[d].ioctl = shim;
+
+    (void)memset(&priv[d], 0, sizeof(priv[d]));
+    (void)memset(&ctx[d], 0, sizeof(ctx[d]));
+    ctx[d].read_reg = (d < 2U) ? i3g4250d_linux_i2c_read :
+                      i3g4250d_linux_spi_read;
+    ctx[d].write_reg = (d < 2U) ? i3g4250d_linux_i2c_write :
+                       i3g4250d_linux_spi_write;
+    ctx[d].handle = &bus[d];
+    ctx[d].priv_data = &priv[d];
+    CHECK(i3g4250d_bus_mode_set(&ctx[d], (d < 2U) ? I3G4250D_BUS_I2C :
+                                I3G4250D_BUS_SPI) == 0);
+  }
+
+  /* one system call per register access, on I2C and SPI */
+  for (d = 0U; d < 3U; d++)
+  {
+    calls = 0U;
+    CHECK(i3g4250d_device_id_get(&ctx[d], &v) == 0);
+    CHECK((v == I3G4250D_ID) && (calls == 1U));
+
+    calls = 0U;
+    CHECK(i3g4250d_fifo_angular_rate_raw_get(&ctx[d], val, 32U) == 0);
+    CHECK((calls == 1U) && (memcmp(val, sens[d].fifo, 192U) == 0));
+
+    calls = 0U;
+    CHECK(i3g4250d_full_scale_set(&ctx[d], I3G4250D_2000dps) == 0);
+    CHECK((calls == 2U) && (sens[d].regs[I3G4250D_CTRL_REG4] == 0x20U));
+
+    /* multi-byte write: auto-increment over the thresholds */
+    buf[0] = 0x12U;
+    buf[1] = 0x34U;
+    CHECK(i3g4250d_write_reg(&ctx[d], I3G4250D_INT1_TSH_XH, buf, 2U) == 0);
+    CHECK((sens[d].regs[I3G4250D_INT1_TSH_XH] == 0x12U) &&
+          (sens[d].regs[I3G4250D_INT1_TSH_XL] == 0x34U));
+  }
+
+  /* I2C write longer than the message buffer */
+  CHECK(i3g4250d_linux_i2c_write(&bus[0], 0x20U, buf,
+                                 I3G4250D_LINUX_WRITE_MAX + 1U) == -1);
+
+  /* samples of two sensors sharing the I2C bus in one system call */
+  rd[0].bus = &bus[0];
+  rd[0].reg = I3G4250D_OUT_X_L;
+  rd[0].buf = (uint8_t *)val;
+  rd[0].len = 96U;
+  rd[1].bus = &bus[1];
+  rd[1].reg = I3G4250D_OUT_X_L;
+  rd[1].buf = (uint8_t *)val_b;
+  rd[1].len = 96U;
+  rd[2].bus = &bus[1];
+  rd[2].reg = I3G4250D_WHO_AM_I;
+  rd[2].buf = &v;
+  rd[2].len = 1U;
+  calls = 0U;
+  segments = 0U;
+  v = 0U;
+  CHECK(i3g4250d_linux_i2c_read_batch(rd, 3U) == 0);
+  CHECK((calls == 1U) && (segments == 6U));
+  CHECK(memcmp(val, sens[0].fifo, 96U) == 0);
+  CHECK(memcmp(val_b, sens[1].fifo, 96U) == 0);
+  CHECK(v == I3G4250D_ID);
+
+  /* SPI: status and samples of one device, chip select in between */
+  sens[2].regs[I3G4250D_STATUS_REG] = 0x0FU;
+  rd[0].bus = &bus[2];
+  rd[0].reg = I3G4250D_STATUS_REG;
+  rd[0].buf = &status;
+  rd[0].len = 1U;
+  rd[1].bus = &bus[2];
+  rd[1].reg = I3G4250D_OUT_X_L;
+  rd[1].buf = (uint8_t *)val;
+  rd[1].len = 6U;
+  calls = 0U;
+  segments = 0U;
+  CHECK(i3g4250d_linux_spi_read_batch(rd, 2U) == 0);
+  CHECK((calls == 1U) && (segments == 4U));
+  CHECK((status == 0x0FU) && (memcmp(val, sens[2].fifo, 6U) == 0));
+
+  CHECK(i3g4250d_linux_i2c_read_batch(rd, 0U) == -1);
+  CHECK(i3g4250d_linux_spi_read_batch(rd,
+                                      I3G4250D_LINUX_BATCH_MAX + 1U) == -1);
+
+  /* errors of the system call */
+  fail = 1;
+  for (d = 0U; d < 3U; d++)
+  {
+    CHECK(i3g4250d_device_id_get(&ctx[d], &v) != 0);
+    CHECK(i3g4250d_full_scale_set(&ctx[d], I3G4250D_245dps) != 0);
+  }
+  CHECK(i3g4250d_linux_spi_read_batch(rd, 2U) == -1);
+  fail = 0;
+
+  TEST_END();
+}
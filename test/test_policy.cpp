@@ -0,0 +1,208 @@
+/*
+ ******************************************************************************
+ * @file    test_policy.cpp
+ * @brief   C++17 driver of i3g4250d.hpp on an in-memory bus policy:
+ *          field descriptors, C structure interop, register image
+ *          against the C API, auto-increment, byte order, FIFO drain,
+ *          and the stmdev_ctx_t bus policy.
+ ******************************************************************************
+ */
+
+#include "i3g4250d.hpp"
+#include "test.h"
+
+static_assert(i3g4250d::fld::fs::shift == 4U, "fs position");
+static_assert(i3g4250d::fld::dr::shift == 6U, "dr position");
+static_assert(i3g4250d::fld::fm::shift == 5U, "fm position");
+static_assert(i3g4250d::fld::wtm::mask == 0x1FU, "wtm mask");
+
+struct memory
+{
+  uint8_t regs[0x40];
+  uint8_t fifo[I3G4250D_FIFO_DEPTH * 6U];
+  uint8_t last_sub;
+  uint32_t transfers;
+};
+
+static void mem_read(memory *m, uint8_t sub, uint8_t *buf, uint16_t len)
+{
+  const uint8_t reg = static_cast<uint8_t>(sub & 0x3FU);
+
+  m->last_sub = sub;
+  m->transfers++;
+  if (reg == I3G4250D_OUT_X_L)
+  {
+    (void)memcpy(buf, m->fifo, len);
+  }
+  else
+  {
+    (void)memcpy(buf, &m->regs[reg], len);
+  }
+}
+
+static void mem_write(memory *m, uint8_t sub, const uint8_t *buf,
+                      uint16_t len)
+{
+  m->last_sub = sub;
+  m->transfers++;
+  (void)memcpy(&m->regs[sub & 0x3FU], buf, len);
+}
+
+/* bus policy: I2C sub-address, platform access inlined */
+struct mem_bus
+{
+  static constexpr uint8_t auto_increment = I3G4250D_I2C_AUTO_INCREMENT;
+
+  memory *m;
+
+  int32_t read(uint8_t reg, uint8_t *data, uint16_t len)
+  {
+    mem_read(m, reg, data, len);
+    return 0;
+  }
+
+  int32_t write(uint8_t reg, const uint8_t *data, uint16_t len)
+  {
+    mem_write(m, reg, data, len);
+    return 0;
+  }
+};
+
+static int32_t ctx_read(void *handle, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
+{
+  mem_read(static_cast<memory *>(handle), reg, buf, len);
+  return 0;
+}
+
+static int32_t ctx_write(void *handle, uint8_t reg, const uint8_t *buf,
+                         uint16_t len)
+{
+  mem_write(static_cast<memory *>(handle), reg, buf, len);
+  return 0;
+}
+
+static memory mc;
+static memory mp;
+
+int main(void)
+{
+  i3g4250d::device<mem_bus> dev(mem_bus{&mp});
+  i3g4250d_ctrl_reg1_t ctrl_reg1;
+  i3g4250d_ctrl_reg4_t ctrl_reg4;
+  i3g4250d_priv_t priv;
+  i3g4250d_fs_t fs;
+  stmdev_ctx_t ctx;
+  int16_t val[3U * I3G4250D_FIFO_DEPTH];
+  uint8_t num;
+  uint8_t v;
+  uint16_t i;
+
+  (void)memset(&priv, 0, sizeof(priv));
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = ctx_read;
+  ctx.write_reg = ctx_write;
+  ctx.handle = &mc;
+
+  for (i = 0U; i < sizeof(mc.fifo); i++)
+  {
+    mc.fifo[i] = static_cast<uint8_t>(i * 7U);
+    mp.fifo[i] = mc.fifo[i];
+  }
+  mc.regs[I3G4250D_WHO_AM_I] = I3G4250D_ID;
+  mp.regs[I3G4250D_WHO_AM_I] = I3G4250D_ID;
+  mc.regs[I3G4250D_CTRL_REG1] = 0x07U;    /* reset value */
+  mp.regs[I3G4250D_CTRL_REG1] = 0x07U;
+
+  /* same configuration, same register image as the C API */
+  CHECK(i3g4250d_data_rate_set(&ctx, I3G4250D_ODR_800Hz) == 0);
+  CHECK(i3g4250d_full_scale_set(&ctx, I3G4250D_500dps) == 0);
+  CHECK(i3g4250d_fifo_watermark_set(&ctx, 20U) == 0);
+  CHECK(i3g4250d_fifo_mode_set(&ctx, I3G4250D_FIFO_STREAM_MODE) == 0);
+  CHECK(i3g4250d_fifo_enable_set(&ctx, 1U) == 0);
+  CHECK(i3g4250d_data_format_set(&ctx, I3G4250D_AUX_MSB_AT_LOW_ADD) == 0);
+
+  CHECK(dev.data_rate_set(I3G4250D_ODR_800Hz) == 0);
+  CHECK(dev.full_scale_set(I3G4250D_500dps) == 0);
+  CHECK(dev.fifo_watermark_set(20U) == 0);
+  CHECK(dev.fifo_mode_set(I3G4250D_FIFO_STREAM_MODE) == 0);
+  CHECK(dev.fifo_enable_set(1U) == 0);
+  CHECK(dev.data_format_set(I3G4250D_AUX_MSB_AT_LOW_ADD) == 0);
+
+  CHECK(memcmp(mc.regs, mp.regs, sizeof(mc.regs)) == 0);
+
+  /* C structures and fields on the same registers */
+  CHECK(dev.read<I3G4250D_CTRL_REG1>(ctrl_reg1) == 0);
+  CHECK((ctrl_reg1.dr == 3U) && (ctrl_reg1.pd == 0x0FU));
+  CHECK(dev.get<i3g4250d::fld::fs>(v) == 0);
+  CHECK(v == static_cast<uint8_t>(I3G4250D_500dps));
+  CHECK(dev.get<i3g4250d::fld::wtm>(v) == 0);
+  CHECK(v == 20U);
+
+  ctrl_reg4.sim = 0U;
+  ctrl_reg4.st = 0U;
+  ctrl_reg4.not_used_01 = 0U;
+  ctrl_reg4.fs = static_cast<uint8_t>(I3G4250D_2000dps);
+  ctrl_reg4.ble = 1U;
+  ctrl_reg4.not_used_02 = 0U;
+  CHECK(dev.write<I3G4250D_CTRL_REG4>(ctrl_reg4) == 0);
+  ctx.handle = &mp;
+  CHECK(i3g4250d_full_scale_get(&ctx, &fs) == 0);
+  CHECK(fs == I3G4250D_2000dps);
+  ctx.handle = &mc;
+
+  /* auto-increment bit only on multi-byte transfers */
+  CHECK(dev.device_id_get(v) == 0);
+  CHECK((v == I3G4250D_ID) && (mp.last_sub == I3G4250D_WHO_AM_I));
+  CHECK(dev.angular_rate_raw_get(val) == 0);
+  CHECK(mp.last_sub == (I3G4250D_OUT_X_L | I3G4250D_I2C_AUTO_INCREMENT));
+
+  /* big endian output registers, as decoded by the C API */
+  {
+    int16_t ref[3U * I3G4250D_FIFO_DEPTH];
+
+    CHECK(i3g4250d_angular_rate_raw_get(&ctx, ref) == 0);
+    CHECK(memcmp(val, ref, 6U) != 0);       /* no priv: LSB first */
+    ctx.priv_data = &priv;
+    CHECK(i3g4250d_data_format_set(&ctx, I3G4250D_AUX_MSB_AT_LOW_ADD) == 0);
+    CHECK(i3g4250d_angular_rate_raw_get(&ctx, ref) == 0);
+    CHECK(memcmp(val, ref, 6U) == 0);
+
+    /* FIFO drain: level, capped to max, overrun, empty, bad max */
+    mc.regs[I3G4250D_FIFO_SRC_REG] = 20U;
+    mp.regs[I3G4250D_FIFO_SRC_REG] = 20U;
+    CHECK(i3g4250d_fifo_drain(&ctx, ref, 32U, &num) == 0);
+    CHECK(num == 20U);
+    CHECK(dev.fifo_drain(val, 32U, num) == 0);
+    CHECK((num == 20U) && (memcmp(val, ref, 20U * 6U) == 0));
+    CHECK(dev.fifo_drain(val, 8U, num) == 0);
+    CHECK(num == 8U);
+
+    mp.regs[I3G4250D_FIFO_SRC_REG] = 0x40U;   /* OVRN */
+    CHECK(dev.fifo_drain(val, 32U, num) == 0);
+    CHECK(num == I3G4250D_FIFO_DEPTH);
+
+    mp.regs[I3G4250D_FIFO_SRC_REG] = 0x20U;   /* EMPTY */
+    mp.transfers = 0U;
+    CHECK(dev.fifo_drain(val, 32U, num) == 0);
+    CHECK((num == 0U) && (mp.transfers == 1U));
+    CHECK(dev.fifo_drain(val, 33U, num) == -1);
+    CHECK(num == 0U);
+  }
+
+  /* stmdev_ctx_t policy: the C routines set the auto-increment bit */
+  {
+    i3g4250d::device<i3g4250d::ctx_bus> cdev{i3g4250d::ctx_bus(&ctx)};
+
+    CHECK(i3g4250d_bus_mode_set(&ctx, I3G4250D_BUS_I2C) == 0);
+    CHECK(cdev.device_id_get(v) == 0);
+    CHECK((v == I3G4250D_ID) && (mc.last_sub == I3G4250D_WHO_AM_I));
+    CHECK(cdev.angular_rate_raw_get(val) == 0);
+    CHECK(mc.last_sub == (I3G4250D_OUT_X_L | I3G4250D_I2C_AUTO_INCREMENT));
+    CHECK(cdev.full_scale_set(I3G4250D_245dps) == 0);
+    CHECK(i3g4250d_full_scale_get(&ctx, &fs) == 0);
+    CHECK(fs == I3G4250D_245dps);
+  }
+
+  TEST_END();
+}
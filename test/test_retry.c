@@ -0,0 +1,138 @@
+/*
+ ******************************************************************************
+ * @file    test_retry.c
+ * @brief   Bus retry policy on the replay transport with injected faults:
+ *          backoff, retry budget, recovery, no retry of reads with side
+ *          effects, and the control register shadow.
+ ******************************************************************************
+ */
+
+#include "i3g4250d_reg.h"
+#include "test.h"
+
+#define SAMPLES 16U
+
+static uint64_t rec[(16U + (SAMPLES * 24U)) / 8U];
+static int16_t val[3U * SAMPLES];
+static uint32_t delays[8];
+static uint32_t ndelays;
+static uint32_t recovers;
+
+static void mdelay(uint32_t ms)
+{
+  if (ndelays < 8U)
+  {
+    delays[ndelays] = ms;
+  }
+  ndelays++;
+}
+
+static int32_t recover(void *handle)
+{
+  (void)handle;
+  recovers++;
+  return 0;
+}
+
+static void stats(const stmdev_ctx_t *ctx, i3g4250d_bus_stats_t *st)
+{
+  CHECK(i3g4250d_bus_stats_get(ctx, st) == 0);
+}
+
+int main(void)
+{
+  static i3g4250d_replay_t rp;
+  i3g4250d_bus_retry_t retry = { recover, 4U, 2U, 1U };
+  i3g4250d_bus_stats_t st;
+  i3g4250d_priv_t priv;
+  stmdev_ctx_t ctx;
+  uint8_t buf[4];
+  int16_t raw[3];
+  uint32_t len;
+  uint32_t served;
+  uint16_t i;
+
+  for (i = 0U; i < (3U * SAMPLES); i++)
+  {
+    val[i] = (int16_t)(i * 11U);
+  }
+
+  len = test_recording(rec, sizeof(rec), val, SAMPLES, 0x0FU, 10000U);
+  CHECK(i3g4250d_replay_init(&rp, (const uint8_t *)rec, len, NULL) == 0);
+
+  (void)memset(&priv, 0, sizeof(priv));
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = i3g4250d_replay_read;
+  ctx.write_reg = i3g4250d_replay_write;
+  ctx.mdelay = mdelay;
+  ctx.handle = &rp;
+  ctx.priv_data = &priv;
+  CHECK(i3g4250d_bus_retry_set(&ctx, &retry) == 0);
+
+  /* every other transaction fails: one retry completes the write */
+  i3g4250d_replay_fault_set(&rp, 2U);
+  buf[0] = 0x4FU;
+  CHECK(i3g4250d_write_reg(&ctx, I3G4250D_CTRL_REG1, buf, 1) == 0);
+  CHECK(i3g4250d_write_reg(&ctx, I3G4250D_CTRL_REG1, buf, 1) == 0);
+  CHECK(rp.regs[I3G4250D_CTRL_REG1] == 0x4FU);
+  stats(&ctx, &st);
+  CHECK((st.errors == 1U) && (st.retried == 1U) && (st.failed == 0U));
+  CHECK((ndelays == 1U) && (delays[0] == 1U));
+  CHECK(priv.tokens == 3U);   /* a retry is not refilled by its success */
+
+  /* every transaction fails: backoff doubles, then recovery and a last
+     attempt */
+  i3g4250d_replay_fault_set(&rp, 1U);
+  ndelays = 0U;
+  CHECK(i3g4250d_read_reg(&ctx, I3G4250D_WHO_AM_I, buf, 1) != 0);
+  stats(&ctx, &st);
+  CHECK((st.errors == 5U) && (st.failed == 1U));
+  CHECK((ndelays == 2U) && (delays[0] == 1U) && (delays[1] == 2U));
+  CHECK((recovers == 1U) && (priv.tokens == 1U));
+
+  /* the budget bounds the retries of a burst of errors */
+  ndelays = 0U;
+  CHECK(i3g4250d_read_reg(&ctx, I3G4250D_WHO_AM_I, buf, 1) != 0);
+  CHECK(i3g4250d_read_reg(&ctx, I3G4250D_WHO_AM_I, buf, 1) != 0);
+  CHECK((ndelays == 1U) && (priv.tokens == 0U) && (recovers == 3U));
+  stats(&ctx, &st);
+  CHECK((st.errors == 10U) && (st.failed == 3U));
+
+  /* successful transactions refill the budget */
+  i3g4250d_replay_fault_set(&rp, 0U);
+  for (i = 0U; i < 10U; i++)
+  {
+    CHECK(i3g4250d_read_reg(&ctx, I3G4250D_WHO_AM_I, buf, 1) == 0);
+  }
+  CHECK(buf[0] == I3G4250D_ID);
+  CHECK(priv.tokens == 4U);
+
+  /* reads of the output registers and of INT1_SRC are never repeated */
+  CHECK(i3g4250d_angular_rate_raw_get(&ctx, raw) == 0);
+  served = rp.seq;
+  i3g4250d_replay_fault_set(&rp, 1U);
+  ndelays = 0U;
+  recovers = 0U;
+  CHECK(i3g4250d_angular_rate_raw_get(&ctx, raw) != 0);
+  CHECK(i3g4250d_read_reg(&ctx, I3G4250D_INT1_SRC, buf, 1) != 0);
+  CHECK(i3g4250d_read_reg(&ctx, I3G4250D_STATUS_REG, buf, 2) != 0);
+  stats(&ctx, &st);
+  CHECK((st.unrecoverable == 3U) && (st.errors == 13U));
+  CHECK((st.failed == 6U) && (ndelays == 0U) && (recovers == 0U));
+  CHECK(priv.tokens == 4U);
+  i3g4250d_replay_fault_set(&rp, 0U);
+  CHECK(i3g4250d_angular_rate_raw_get(&ctx, raw) == 0);
+  CHECK((rp.seq == (served + 1U)) && (raw[0] == val[3]));
+
+  /* the shadow takes the consecutive registers of a burst only when the
+     driver sets the auto-increment bit */
+  (void)memset(&priv, 0, sizeof(priv));
+  CHECK(i3g4250d_read_reg(&ctx, I3G4250D_CTRL_REG1, buf, 4) == 0);
+  CHECK(priv.ctrl_valid == 0x01U);
+  CHECK(i3g4250d_bus_mode_set(&ctx, I3G4250D_BUS_I2C) == 0);
+  CHECK(i3g4250d_read_reg(&ctx, I3G4250D_CTRL_REG1, buf, 4) == 0);
+  CHECK(priv.ctrl_valid == 0x0FU);
+  CHECK(priv.ctrl_reg[0] == 0x4FU);
+
+  TEST_END();
+}
@@ -0,0 +1,218 @@
+/*
+ ******************************************************************************
+ * @file    test_shared_ctx.c
+ * @brief   Stress test of a context shared by several threads: bus lock,
+ *          per-register read-modify-write locks and lock-free reads of the
+ *          cached registers. Also built with -fsanitize=thread (make tsan).
+ ******************************************************************************
+ */
+
+#include "i3g4250d_reg.h"
+#include "test.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define LOOPS 5000
+
+static pthread_mutex_t bus_mtx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t reg_mtx[0x40];
+static uint8_t regs[0x40];
+static int violations;
+static int stop;
+
+static void lock(void *handle, uint8_t id)
+{
+  (void)handle;
+  (void)pthread_mutex_lock((id == I3G4250D_LOCK_BUS) ? &bus_mtx :
+                           &reg_mtx[id & 0x3FU]);
+}
+
+static void unlock(void *handle, uint8_t id)
+{
+  (void)handle;
+  (void)pthread_mutex_unlock((id == I3G4250D_LOCK_BUS) ? &bus_mtx :
+                             &reg_mtx[id & 0x3FU]);
+}
+
+/* the transport must only run with the bus lock held */
+static void check_bus_held(void)
+{
+  if (pthread_mutex_trylock(&bus_mtx) != EBUSY)
+  {
+    (void)pthread_mutex_unlock(&bus_mtx);
+    __atomic_fetch_add(&violations, 1, __ATOMIC_RELAXED);
+  }
+}
+
+static int32_t bus_read(void *handle, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
+{
+  uint16_t i;
+
+  (void)handle;
+  check_bus_held();
+  for (i = 0U; i < len; i++)
+  {
+    buf[i] = regs[(reg + i) & 0x3FU];
+  }
+
+  /* let the other threads run between the read and the write back */
+  (void)sched_yield();
+
+  return 0;
+}
+
+static int32_t bus_write(void *handle, uint8_t reg, const uint8_t *buf,
+                         uint16_t len)
+{
+  uint8_t addr = reg & 0x3FU;
+  uint8_t diff;
+
+  (void)handle;
+  check_bus_held();
+
+  if ((len == 1U) && (addr == I3G4250D_CTRL_REG4))
+  {
+    /* each setter changes one field of the current value: a lost update
+       shows up as a write changing both fields */
+    diff = (uint8_t)(buf[0] ^ regs[addr]);
+    if (((diff & 0x30U) != 0U) && ((diff & 0x40U) != 0U))
+    {
+      __atomic_fetch_add(&violations, 1, __ATOMIC_RELAXED);
+    }
+  }
+
+  (void)memcpy(&regs[addr], buf, len);
+
+  return 0;
+}
+
+static i3g4250d_priv_t priv;
+static stmdev_ctx_t ctx = { bus_write, bus_read, NULL, NULL, &priv };
+static int bad_reads;
+static uint32_t good_reads;
+
+static void *fs_writer(void *arg)
+{
+  int i;
+
+  (void)arg;
+  for (i = 0; i < LOOPS; i++)
+  {
+    (void)i3g4250d_full_scale_set(&ctx, ((i & 1) != 0) ? I3G4250D_500dps :
+                                  I3G4250D_245dps);
+  }
+
+  return NULL;
+}
+
+static void *ble_writer(void *arg)
+{
+  int i;
+
+  (void)arg;
+  for (i = 0; i < LOOPS; i++)
+  {
+    (void)i3g4250d_data_format_set(&ctx, ((i & 1) != 0) ?
+                                   I3G4250D_AUX_MSB_AT_LOW_ADD :
+                                   I3G4250D_AUX_LSB_AT_LOW_ADD);
+  }
+
+  return NULL;
+}
+
+static void *odr_writer(void *arg)
+{
+  uint8_t burst[5];
+  int i;
+
+  (void)arg;
+  for (i = 0; i < LOOPS; i++)
+  {
+    (void)i3g4250d_data_rate_set(&ctx, ((i & 1) != 0) ? I3G4250D_ODR_800Hz :
+                                 I3G4250D_ODR_100Hz);
+    if ((i % 16) == 0)
+    {
+      /* multi-byte transaction refreshing the whole shadow */
+      (void)i3g4250d_read_reg(&ctx, I3G4250D_CTRL_REG1, burst, 5);
+    }
+  }
+
+  return NULL;
+}
+
+static void *reader(void *arg)
+{
+  uint8_t val;
+
+  (void)arg;
+  while (__atomic_load_n(&stop, __ATOMIC_ACQUIRE) == 0)
+  {
+    if (i3g4250d_ctrl_reg_cached_get(&ctx, I3G4250D_CTRL_REG1, &val) == 0)
+    {
+      /* power-up value, or one of the two rates set */
+      if ((val != 0x00U) && (val != 0x0FU) && (val != 0xCFU)) { bad_reads++; }
+      good_reads++;
+    }
+
+    if (i3g4250d_ctrl_reg_cached_get(&ctx, I3G4250D_CTRL_REG4, &val) == 0)
+    {
+      if ((val & (uint8_t)~0x50U) != 0U) { bad_reads++; }
+      good_reads++;
+    }
+
+    (void)sched_yield();
+  }
+
+  return NULL;
+}
+
+int main(void)
+{
+  i3g4250d_lock_t locks = { lock, unlock, NULL };
+  pthread_t wr[3];
+  pthread_t rd;
+  i3g4250d_fs_t fs;
+  i3g4250d_ble_t ble;
+  uint8_t val;
+  int i;
+
+  for (i = 0; i < 0x40; i++)
+  {
+    (void)pthread_mutex_init(&reg_mtx[i], NULL);
+  }
+
+  (void)i3g4250d_bus_mode_set(&ctx, I3G4250D_BUS_I2C);
+  CHECK(i3g4250d_lock_set(&ctx, &locks) == 0);
+  CHECK(i3g4250d_ctrl_reg_cached_get(&ctx, I3G4250D_CTRL_REG1, &val) == -1);
+
+  (void)pthread_create(&rd, NULL, reader, NULL);
+  (void)pthread_create(&wr[0], NULL, fs_writer, NULL);
+  (void)pthread_create(&wr[1], NULL, ble_writer, NULL);
+  (void)pthread_create(&wr[2], NULL, odr_writer, NULL);
+
+  for (i = 0; i < 3; i++)
+  {
+    (void)pthread_join(wr[i], NULL);
+  }
+
+  __atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+  (void)pthread_join(rd, NULL);
+
+  CHECK(violations == 0);
+  CHECK(bad_reads == 0);
+  CHECK(good_reads > 0U);
+
+  /* last values of both writers survive in CTRL_REG4 */
+  CHECK(i3g4250d_full_scale_get(&ctx, &fs) == 0);
+  CHECK(fs == I3G4250D_500dps);
+  CHECK(i3g4250d_data_format_get(&ctx, &ble) == 0);
+  CHECK(ble == I3G4250D_AUX_MSB_AT_LOW_ADD);
+  CHECK(i3g4250d_ctrl_reg_cached_get(&ctx, I3G4250D_CTRL_REG4, &val) == 0);
+  CHECK(val == regs[I3G4250D_CTRL_REG4]);
+  CHECK(i3g4250d_ctrl_reg_cached_get(&ctx, I3G4250D_CTRL_REG1, &val) == 0);
+  CHECK(val == 0xCFU);
+
+  TEST_END();
+}
@@ -0,0 +1,135 @@
+/*
+ ******************************************************************************
+ * @file    test_soa.c
+ * @brief   FIFO samples in separate X, Y, Z lanes, against the bytes read,
+ *          for every block size and both device byte orders, and lane
+ *          alignment. Built once with the vector deinterleave and once
+ *          with the scalar one (I3G4250D_SOA_SIMD=0).
+ ******************************************************************************
+ */
+
+#include "i3g4250d_reg.h"
+#include "test.h"
+
+static uint8_t regs[0x40];
+static uint8_t fifo[I3G4250D_FIFO_DEPTH * 6U];
+
+static int32_t bus_read(void *handle, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
+{
+  (void)handle;
+  if (reg == I3G4250D_OUT_X_L)
+  {
+    (void)memcpy(buf, fifo, len);
+  }
+  else
+  {
+    (void)memcpy(buf, &regs[reg], len);
+  }
+  return 0;
+}
+
+static int32_t bus_write(void *handle, uint8_t reg, const uint8_t *buf,
+                         uint16_t len)
+{
+  (void)handle;
+  (void)memcpy(&regs[reg], buf, len);
+  return 0;
+}
+
+/* sample n, axis a of the FIFO bytes, for the device byte order */
+static int16_t expected(uint8_t n, uint8_t a, i3g4250d_ble_t ble)
+{
+  const uint8_t *b = &fifo[(6U * n) + (2U * a)];
+
+  return (ble == I3G4250D_AUX_LSB_AT_LOW_ADD) ?
+         (int16_t)(((uint16_t)b[1] << 8) | b[0]) :
+         (int16_t)(((uint16_t)b[0] << 8) | b[1]);
+}
+
+static uint32_t lanes_check(const i3g4250d_fifo_soa_t *blk, uint8_t num,
+                            i3g4250d_ble_t ble)
+{
+  uint32_t bad = 0U;
+  uint8_t n;
+
+  for (n = 0U; n < num; n++)
+  {
+    bad += (blk->x[n] != expected(n, 0U, ble)) ? 1U : 0U;
+    bad += (blk->y[n] != expected(n, 1U, ble)) ? 1U : 0U;
+    bad += (blk->z[n] != expected(n, 2U, ble)) ? 1U : 0U;
+  }
+
+  return bad;
+}
+
+int main(void)
+{
+  static i3g4250d_fifo_soa_t blks[3];
+  const i3g4250d_ble_t order[2] = { I3G4250D_AUX_LSB_AT_LOW_ADD,
+                                    I3G4250D_AUX_MSB_AT_LOW_ADD
+                                  };
+  i3g4250d_fifo_soa_t blk;
+  i3g4250d_priv_t priv;
+  stmdev_ctx_t ctx;
+  uint32_t seed = 12345U;
+  uint32_t bad;
+  uint8_t num;
+  uint8_t got;
+  uint8_t o;
+  uint16_t i;
+
+  (void)printf("vector deinterleave: %d\n", I3G4250D_SOA_SIMD);
+
+  for (i = 0U; i < sizeof(fifo); i++)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    fifo[i] = (uint8_t)(seed >> 16);
+  }
+
+  (void)memset(&priv, 0, sizeof(priv));
+  (void)memset(&ctx, 0, sizeof(ctx));
+  ctx.read_reg = bus_read;
+  ctx.write_reg = bus_write;
+  ctx.priv_data = &priv;
+
+  /* lanes aligned on the stack, statically and in arrays */
+  CHECK(((uintptr_t)&blk % I3G4250D_SOA_ALIGN) == 0U);
+  for (o = 0U; o < 3U; o++)
+  {
+    CHECK(((uintptr_t)blks[o].x % I3G4250D_SOA_ALIGN) == 0U);
+    CHECK(((uintptr_t)blks[o].y % I3G4250D_SOA_ALIGN) == 0U);
+    CHECK(((uintptr_t)blks[o].z % I3G4250D_SOA_ALIGN) == 0U);
+  }
+
+  CHECK(i3g4250d_fifo_angular_rate_raw_soa_get(&ctx, &blk, 0U) == -1);
+  CHECK(i3g4250d_fifo_angular_rate_raw_soa_get(&ctx, &blk, 33U) == -1);
+
+  /* every block size, both byte orders */
+  for (o = 0U; o < 2U; o++)
+  {
+    CHECK(i3g4250d_data_format_set(&ctx, order[o]) == 0);
+
+    bad = 0U;
+    for (num = 1U; num <= I3G4250D_FIFO_DEPTH; num++)
+    {
+      (void)memset(&blk, 0xA5, sizeof(blk));
+      CHECK(i3g4250d_fifo_angular_rate_raw_soa_get(&ctx, &blk, num) == 0);
+      bad += lanes_check(&blk, num, order[o]);
+    }
+    CHECK(bad == 0U);
+  }
+
+  /* drain: FIFO level, capped to max, and empty FIFO */
+  regs[I3G4250D_FIFO_SRC_REG] = 20U;
+  CHECK(i3g4250d_fifo_drain_soa(&ctx, &blks[1], 32U, &got) == 0);
+  CHECK((got == 20U) && (lanes_check(&blks[1], got, order[1]) == 0U));
+  CHECK(i3g4250d_fifo_drain_soa(&ctx, &blks[2], 8U, &got) == 0);
+  CHECK((got == 8U) && (lanes_check(&blks[2], got, order[1]) == 0U));
+
+  regs[I3G4250D_FIFO_SRC_REG] = 0x20U;
+  CHECK(i3g4250d_fifo_drain_soa(&ctx, &blks[0], 32U, &got) == 0);
+  CHECK(got == 0U);
+
+  TEST_END();
+}